@@ -318,6 +318,40 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Send a number of messages to the same thread at once (non-blocking).
+ *
+ * Delivers the messages in order, as far as the target can take them: If the
+ * target is waiting for a message, the first message is copied to it directly
+ * and the remaining ones are put into its queue until the queue is full.
+ * Interrupts are disabled only once for all messages. This function never
+ * blocks and can be called from an interrupt.
+ *
+ * @param[in] m             Array of @p numof preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] numof         Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered, the remaining ones were not sent
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid);
+
+/**
+ * @brief Receive a number of messages at once.
+ *
+ * Blocks until at least one message was received, then takes as many of the
+ * messages already waiting for the calling thread (queued or from blocked
+ * senders) as fit into @p m, with interrupts disabled only once.
+ *
+ * @param[out] m    Array of @p max preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] max   Number of messages that fit into @p m, must not be 0
+ *
+ * @return  number of messages received
+ */
+int msg_receive_many(msg_t *m, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
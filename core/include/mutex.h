@@ -91,6 +91,24 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ *
+ * With the module `core_mutex_priority_inheritance`, each mutex additionally
+ * stores the PID of the thread holding it. When a thread blocks on a mutex
+ * whose owner has a lower priority, the owner temporarily inherits the
+ * priority of the blocked thread using @ref sched_change_priority. If the
+ * owner itself is blocked on a mutex, this is repeated along the chain of
+ * owners.
+ *
+ * When a boosted thread unlocks a mutex, its priority is lowered to the
+ * highest priority of the threads still waiting for any other mutex it holds,
+ * or back to its own priority if there are none. This keeps nested locks
+ * boosted as long as needed, regardless of the order they are unlocked in.
+ *
+ * @note    Calls to @ref sched_change_priority on a boosted thread are
+ *          overwritten when its priority is restored.
  * @{
  *
  * @file
@@ -127,6 +145,14 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The PID of the thread holding the mutex, or
+     *          @ref KERNEL_PID_UNDEF if unknown
+     * @internal
+     */
+    kernel_pid_t owner;
+#endif
 } mutex_t;
 
 /**
@@ -141,16 +167,21 @@ typedef struct {
     uint8_t cancelled;  /**< Flag whether the mutex has been cancelled */
 } mutex_cancel_t;
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF }
+#else
+#define MUTEX_INIT { { NULL } }
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -171,6 +202,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -231,6 +265,9 @@ static inline int mutex_trylock(mutex_t *mutex)
 
     if (mutex->queue.next == NULL) {
         mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = thread_getpid();
+#endif
         retval = 1;
     }
     irq_restore(irq_state);
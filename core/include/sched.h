@@ -301,6 +301,25 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
 void sched_register_cb(sched_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
+#if IS_USED(MODULE_SCHED_READY_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Thread ready callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It is called with interrupts disabled whenever a thread that was
+ *          blocked enters its runqueue, i.e. becomes ready to run. Use
+ *          @ref irq_is_in() to tell whether the thread was woken up from
+ *          interrupt context.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread that became ready
+ */
+extern void sched_ready_callback(thread_t *thread);
+#endif
+
 /**
  * @brief   Advance a runqueue
  *
@@ -341,6 +360,27 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_RUNQ_SELECT)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler runqueue selection callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It is called with interrupts disabled whenever the scheduler is
+ *          run, right before it activates the thread at the head of the
+ *          runqueue of priority @p prio. The callback may reorder that
+ *          runqueue (e.g. move another thread to its head), but must neither
+ *          add nor remove threads.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   prio      the priority of the runqueue that is about to be run
+ *
+ */
+extern void sched_runq_select_callback(uint8_t prio);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
@@ -193,6 +193,11 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    void *mutex_wait;               /**< mutex the thread is blocked on */
+    uint8_t base_priority;          /**< priority without inheritance, or
+                                         SCHED_PRIO_LEVELS if not boosted */
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
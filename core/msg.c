@@ -433,6 +433,97 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_send_many(msg_t *m, unsigned numof, kernel_pid_t target_pid)
+{
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_many(): target_pid is invalid\n");
+        return -1;
+    }
+
+    kernel_pid_t sender_pid = irq_is_in() ? KERNEL_PID_ISR : thread_getpid();
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+    unsigned sent = 0;
+
+    if (target == NULL) {
+        DEBUG("msg_send_many(): target thread %d does not exist\n", target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((numof > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_many(): Direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        sent++;
+    }
+    for (; sent < numof; sent++) {
+        m[sent].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[sent])) {
+            break;
+        }
+    }
+
+    uint16_t target_prio = target->priority;
+
+    irq_restore(state);
+    if (sent > 0) {
+        sched_switch(target_prio);
+    }
+    return sent;
+}
+
+int msg_receive_many(msg_t *m, unsigned max)
+{
+    unsigned received = 1;
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+
+    assert(max > 0);
+    _msg_receive(&m[0], 1);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+
+    while (received < max) {
+        int queue_index = -1;
+
+        if (thread_has_msg_queue(me)) {
+            queue_index = cib_get(&(me->msg_queue));
+        }
+        if (queue_index >= 0) {
+            m[received++] = me->msg_array[queue_index];
+            continue;
+        }
+
+        /* queue is drained, messages of blocked senders are newer */
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+
+        if (next == NULL) {
+            break;
+        }
+
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+
+        m[received++] = *((msg_t *)sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return received;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -33,6 +33,110 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/**
+ * @brief   Re-sort @p thread into the waiting queue of the mutex it is blocked
+ *          on, after its priority was changed
+ * @pre     IRQs are disabled
+ */
+static void _requeue(thread_t *thread)
+{
+    mutex_t *mutex = thread->mutex_wait;
+
+    if (mutex && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        thread_add_to_list(&mutex->queue, thread);
+    }
+}
+
+/**
+ * @brief   Let the owner of @p mutex (and the owners of the mutexes it is
+ *          blocked on) inherit the priority @p prio
+ * @pre     IRQs are disabled
+ */
+static void _inherit_priority(mutex_t *mutex, uint8_t prio)
+{
+    /* the chain is bounded to not loop forever in case of a deadlock */
+    for (unsigned i = 0; mutex && (i < MAXTHREADS); i++) {
+        thread_t *owner = thread_get(mutex->owner);
+
+        if (!owner || (owner->priority <= prio)) {
+            return;
+        }
+
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid ": %u --> %u\n",
+              thread_getpid(), owner->pid, (unsigned)owner->priority,
+              (unsigned)prio);
+        if (owner->base_priority == SCHED_PRIO_LEVELS) {
+            owner->base_priority = owner->priority;
+        }
+        sched_change_priority(owner, prio);
+        _requeue(owner);
+        mutex = owner->mutex_wait;
+    }
+}
+
+/**
+ * @brief   Lower the priority of the boosted thread @p owner to what the
+ *          threads still waiting for a mutex it holds require
+ * @pre     IRQs are disabled
+ */
+static void _restore_priority(thread_t *owner)
+{
+    if (!owner || (owner->base_priority == SCHED_PRIO_LEVELS)) {
+        return;
+    }
+
+    uint8_t prio = owner->base_priority;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *waiter = thread_get_unchecked(pid);
+
+        if (waiter && (waiter->status == STATUS_MUTEX_BLOCKED)
+            && waiter->mutex_wait
+            && (((mutex_t *)waiter->mutex_wait)->owner == owner->pid)
+            && (waiter->priority < prio)) {
+            prio = waiter->priority;
+        }
+    }
+
+    if (prio == owner->base_priority) {
+        owner->base_priority = SCHED_PRIO_LEVELS;
+    }
+
+    if (prio != owner->priority) {
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid ": %u --> %u\n",
+              thread_getpid(), owner->pid, (unsigned)owner->priority,
+              (unsigned)prio);
+        sched_change_priority(owner, prio);
+        _requeue(owner);
+    }
+}
+
+/**
+ * @brief   Hand @p mutex over to @p owner and return the previous owner
+ * @pre     IRQs are disabled
+ */
+static thread_t *_set_owner(mutex_t *mutex, kernel_pid_t owner)
+{
+    thread_t *prev = thread_get(mutex->owner);
+
+    mutex->owner = owner;
+    return prev;
+}
+#else
+static inline thread_t *_set_owner(mutex_t *mutex, kernel_pid_t owner)
+{
+    (void)mutex;
+    (void)owner;
+    return NULL;
+}
+
+static inline void _restore_priority(thread_t *owner)
+{
+    (void)owner;
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -64,6 +168,11 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    me->mutex_wait = mutex;
+    _inherit_priority(mutex, me->priority);
+#endif
+
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
@@ -78,6 +187,7 @@ void mutex_lock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -106,6 +216,7 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -137,6 +248,7 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        _restore_priority(_set_owner(mutex, KERNEL_PID_UNDEF));
         irq_restore(irqstate);
         return;
     }
@@ -148,11 +260,16 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
     sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    process->mutex_wait = NULL;
+#endif
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
     }
 
+    _restore_priority(_set_owner(mutex, process->pid));
+
     uint16_t process_priority = process->priority;
 
     irq_restore(irqstate);
@@ -168,6 +285,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _restore_priority(_set_owner(mutex, KERNEL_PID_UNDEF));
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -176,9 +294,13 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            process->mutex_wait = NULL;
+#endif
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _restore_priority(_set_owner(mutex, process->pid));
         }
     }
 
@@ -213,6 +335,11 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        thread->mutex_wait = NULL;
+        /* the owner may no longer need the priority of the cancelled thread */
+        _restore_priority(thread_get(mutex->owner));
+#endif
         irq_restore(irq_state);
         sched_switch(thread->priority);
         return;
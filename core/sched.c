@@ -158,6 +158,9 @@ thread_t *__attribute__((used)) sched_run(void)
     sched_context_switch_request = 0;
 
     unsigned nextrq = _get_prio_queue_from_runqueue();
+#if (IS_USED(MODULE_SCHED_RUNQ_SELECT))
+    sched_runq_select_callback(nextrq);
+#endif
     thread_t *next_thread = container_of(sched_runqueues[nextrq].next->next,
                                          thread_t, rq_entry);
 
@@ -247,7 +250,7 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
 {
     DEBUG("sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
           thread->pid, thread->priority);
-    clist_lpop(&sched_runqueues[thread->priority]);
+    clist_remove(&sched_runqueues[thread->priority], &(thread->rq_entry));
 
     if (!sched_runqueues[thread->priority].next) {
         _clear_runqueue_bit(thread->priority);
@@ -262,6 +265,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+#if IS_USED(MODULE_SCHED_READY_CALLBACK)
+            sched_ready_callback(process);
+#endif
         }
     }
     else {
@@ -310,6 +316,12 @@ NORETURN void sched_task_exit(void)
     print_stack_usage_metric(me->name, me->stack_start, me->stack_size);
 #endif
 
+#if IS_USED(MODULE_MSG_BUF)
+    /* return buffers sent to this thread, it won't free them anymore */
+    void msg_buf_release_owned(kernel_pid_t pid);
+    msg_buf_release_owned(thread_getpid());
+#endif
+
     (void)irq_disable();
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
@@ -291,6 +291,11 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->mutex_wait = NULL;
+    thread->base_priority = SCHED_PRIO_LEVELS;
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
@@ -68,6 +68,8 @@
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
+static int _recv_loan(netdev_t *netdev, netdev_recv_alloc_t alloc, void *ctx,
+                      void *info);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
@@ -162,6 +164,7 @@ static const netdev_driver_t netdev_driver_tap = {
     .isr = _isr,
     .get = _get,
     .set = _set,
+    .recv_loan = _recv_loan,
 };
 
 /* driver implementation */
@@ -273,6 +276,32 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+static int _recv_loan(netdev_t *netdev, netdev_recv_alloc_t alloc, void *ctx,
+                      void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    int size = 0;
+
+    /* the tap device hands out exactly one frame per read(), so the size of
+     * the next frame in the queue is known without reading it */
+    if ((real_ioctl(dev->tap_fd, FIONREAD, &size) < 0) || (size <= 0)) {
+        DEBUG("netdev_tap: no frame pending\n");
+        return -1;
+    }
+    if ((size_t)size > ETHERNET_FRAME_LEN) {
+        size = ETHERNET_FRAME_LEN;
+    }
+
+    void *buf = alloc(ctx, size);
+
+    if (buf == NULL) {
+        _recv(netdev, NULL, size, NULL);
+        return -ENOBUFS;
+    }
+
+    return _recv(netdev, buf, size, info);
+}
+
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD access
+ * @ingroup     drivers_storage
+ * @brief       Non-blocking read, write and erase requests for MTD devices
+ *
+ * All functions of @ref drivers_mtd block the caller until the operation has
+ * finished, which takes tens of milliseconds for a sector erase. This module
+ * lets the caller submit requests to a per-device queue instead and continue
+ * with other work, e.g. receiving the next chunk of a firmware image while the
+ * previous one is written. The requests are executed in a dedicated worker
+ * thread and the caller is notified about their completion with a callback
+ * and / or an @ref sys_event "event".
+ *
+ * The worker uses the blocking functions of @ref drivers_mtd, so every MTD
+ * device, e.g. @ref drivers_mtd_flashpage or the file backed flash emulation
+ * of `native`, can be used asynchronously.
+ *
+ * Requests are not necessarily executed in the order of submission: A new
+ * request is queued in ascending sector order, but never ahead of a queued
+ * request it conflicts with, i.e. one that accesses the same sectors and of
+ * which at least one modifies them. Adjacent queued requests of the same kind
+ * are merged into a single MTD operation: erases of consecutive sectors, and
+ * reads or writes of consecutive addresses to or from consecutive memory.
+ *
+ * Writes are raw writes (see @ref mtd_write_page_raw()), erase sectors with
+ * @ref mtd_async_erase() first if needed.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static mtd_async_t dev;
+ * static mtd_async_req_t req;
+ *
+ * static void _done(mtd_async_req_t *req)
+ * {
+ *     printf("erase done: %d\n", req->res);
+ * }
+ *
+ * mtd_async_init(&dev, MTD_0);
+ * req.cb = _done;
+ * mtd_async_erase(&dev, &req, 0, 1);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD access
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdint.h>
+
+#include "event.h"
+#include "list.h"
+#include "mtd.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_async_conf Asynchronous MTD access compile configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Stack size of the worker thread
+ */
+#ifndef MTD_ASYNC_STACKSIZE
+#define MTD_ASYNC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the worker thread
+ */
+#ifndef MTD_ASYNC_PRIO
+#define MTD_ASYNC_PRIO          (THREAD_PRIORITY_MAIN - 1)
+#endif
+/** @} */
+
+/**
+ * @brief   Kind of a request
+ */
+typedef enum {
+    MTD_ASYNC_READ,             /**< @ref mtd_read_page() */
+    MTD_ASYNC_WRITE,            /**< @ref mtd_write_page_raw() */
+    MTD_ASYNC_ERASE,            /**< @ref mtd_erase_sector() */
+} mtd_async_op_t;
+
+/**
+ * @brief   Request type
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Completion callback, called in the context of the worker thread
+ *
+ * The request may be reused or submitted again from within the callback.
+ *
+ * @param[in] req   the completed request
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req);
+
+/**
+ * @brief   Request
+ *
+ * @ref mtd_async_req_t::cb, @ref mtd_async_req_t::arg,
+ * @ref mtd_async_req_t::event and @ref mtd_async_req_t::queue are set by the
+ * caller, the other fields by @ref mtd_async_read(), @ref mtd_async_write()
+ * and @ref mtd_async_erase().
+ */
+struct mtd_async_req {
+    list_node_t node;           /**< queue entry */
+    mtd_async_op_t op;          /**< kind of request */
+    void *buf;                  /**< buffer to read to or write from */
+    uint32_t page;              /**< first page, first sector for erases */
+    uint32_t offset;            /**< byte offset from the start of the page */
+    uint32_t count;             /**< number of bytes, sectors for erases */
+    int res;                    /**< result of the MTD operation */
+    mtd_async_cb_t cb;          /**< completion callback, may be NULL */
+    void *arg;                  /**< argument for the callback */
+    event_t *event;             /**< event posted on completion, may be NULL */
+    event_queue_t *queue;       /**< queue to post @ref mtd_async_req_t::event
+                                     to */
+};
+
+/**
+ * @brief   Asynchronous MTD device
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device */
+    list_node_t queue;          /**< queued requests */
+    event_t event;              /**< event of the worker thread */
+} mtd_async_t;
+
+/**
+ * @brief   Initializes an asynchronous MTD device
+ *
+ * Starts the worker thread on the first call.
+ *
+ * @param[out] dev      the asynchronous device
+ * @param[in] mtd       initialized MTD device to access
+ */
+void mtd_async_init(mtd_async_t *dev, mtd_dev_t *mtd);
+
+/**
+ * @brief   Queues a request
+ *
+ * @note    Prefer @ref mtd_async_read(), @ref mtd_async_write() and
+ *          @ref mtd_async_erase() over filling the request manually.
+ *
+ * @param[in] dev       the asynchronous device
+ * @param[in] req       the request, must not be queued already
+ *
+ * @return  0 on success
+ * @return  -EOVERFLOW if the request exceeds the device
+ * @return  -EINVAL if the request is invalid
+ */
+int mtd_async_submit(mtd_async_t *dev, mtd_async_req_t *req);
+
+/**
+ * @brief   Queues a read request
+ *
+ * @param[in] dev       the asynchronous device
+ * @param[in] req       the request
+ * @param[out] dest     buffer to read to
+ * @param[in] page      page to start reading from
+ * @param[in] offset    byte offset from the start of the page
+ * @param[in] count     number of bytes to read
+ *
+ * @return  see @ref mtd_async_submit()
+ */
+static inline int mtd_async_read(mtd_async_t *dev, mtd_async_req_t *req,
+                                 void *dest, uint32_t page, uint32_t offset,
+                                 uint32_t count)
+{
+    req->op = MTD_ASYNC_READ;
+    req->buf = dest;
+    req->page = page;
+    req->offset = offset;
+    req->count = count;
+    return mtd_async_submit(dev, req);
+}
+
+/**
+ * @brief   Queues a write request
+ *
+ * @param[in] dev       the asynchronous device
+ * @param[in] req       the request
+ * @param[in] src       data to write, must stay valid until completion
+ * @param[in] page      page to start writing to
+ * @param[in] offset    byte offset from the start of the page
+ * @param[in] count     number of bytes to write
+ *
+ * @return  see @ref mtd_async_submit()
+ */
+static inline int mtd_async_write(mtd_async_t *dev, mtd_async_req_t *req,
+                                  const void *src, uint32_t page,
+                                  uint32_t offset, uint32_t count)
+{
+    req->op = MTD_ASYNC_WRITE;
+    req->buf = (void *)src;
+    req->page = page;
+    req->offset = offset;
+    req->count = count;
+    return mtd_async_submit(dev, req);
+}
+
+/**
+ * @brief   Queues an erase request
+ *
+ * @param[in] dev       the asynchronous device
+ * @param[in] req       the request
+ * @param[in] sector    first sector to erase
+ * @param[in] count     number of sectors to erase
+ *
+ * @return  see @ref mtd_async_submit()
+ */
+static inline int mtd_async_erase(mtd_async_t *dev, mtd_async_req_t *req,
+                                  uint32_t sector, uint32_t count)
+{
+    req->op = MTD_ASYNC_ERASE;
+    req->buf = NULL;
+    req->page = sector;
+    req->offset = 0;
+    req->count = count;
+    return mtd_async_submit(dev, req);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
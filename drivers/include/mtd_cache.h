@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Read cache and write combining layer for MTD devices
+ *
+ * This MTD module is stacked on top of another MTD device (the parent) and
+ * presents it with the same geometry. It keeps the most recently read pages of
+ * the parent in RAM, so file systems that read the same metadata over and over
+ * again only access the parent on a cache miss. Pages are evicted in least
+ * recently used order.
+ *
+ * Writes to the same sector that are adjacent to each other are collected in
+ * a sector-sized write-back buffer and written to the parent with a single
+ * transfer, e.g. when a file system programs a block in small chunks. The
+ * buffer is written back when a write to another sector or a non-adjacent
+ * location arrives, before powering the parent down and on an explicit call
+ * of @ref mtd_cache_flush().
+ *
+ * Writes keep the semantics of @ref mtd_write_page_raw(): No erase is
+ * performed, so the cache works for any parent. Data written to the same
+ * location twice before a flush is overwritten instead of being programmed
+ * twice, so the layer assumes that writes either target erased memory or a
+ * parent that supports @ref MTD_DRIVER_FLAG_DIRECT_WRITE. This is what file
+ * systems do anyway. Erasing a sector discards pending writes to it.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * The memory of the cache is provided by the application and has to match the
+ * geometry of the parent:
+ *
+ * ```
+ * static mtd_cache_entry_t entries[4];
+ * static uint8_t pages[4 * PAGE_SIZE];
+ * static uint8_t wb[PAGES_PER_SECTOR * PAGE_SIZE];
+ *
+ * static mtd_cache_t cache = MTD_CACHE_INIT(&parent_mtd, entries, pages, wb);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * mtd_init(dev);
+ * ```
+ *
+ * The write-back buffer may be `NULL`, writes are then passed through to the
+ * parent immediately.
+ *
+ * @warning The parent must not be accessed directly while the cache is in use,
+ *          or the cache needs to be dropped with @ref mtd_cache_invalidate()
+ *          afterwards.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Page number of an unused cache entry
+ */
+#define MTD_CACHE_PAGE_INVALID      (UINT32_MAX)
+
+/**
+ * @brief   Initializer of a @ref mtd_cache_t
+ *
+ * @param[in] _parent   parent MTD device
+ * @param[in] _entries  array of @ref mtd_cache_entry_t, one per cached page
+ * @param[in] _pages    memory for the cached pages, page size times the
+ *                      number of @p _entries
+ * @param[in] _wb       sector-sized write-back buffer, may be NULL
+ */
+#define MTD_CACHE_INIT(_parent, _entries, _pages, _wb) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = (_parent), \
+    .lock = MUTEX_INIT, \
+    .entries = (_entries), \
+    .pages = (_pages), \
+    .wb = (_wb), \
+    .numof = ARRAY_SIZE(_entries), \
+}
+
+/**
+ * @brief   Cached page
+ */
+typedef struct {
+    uint32_t page;              /**< page of the parent, or
+                                     @ref MTD_CACHE_PAGE_INVALID */
+    uint32_t last_use;          /**< time stamp of the last access */
+} mtd_cache_entry_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< page reads served from the cache */
+    uint32_t misses;            /**< page reads that accessed the parent */
+    uint32_t merged;            /**< writes merged into pending writes */
+    uint32_t flushes;           /**< writes of the write-back buffer */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD page cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< parent MTD device */
+    mutex_t lock;               /**< lock of the cache */
+    mtd_cache_entry_t *entries; /**< cache entries */
+    uint8_t *pages;             /**< memory of the cached pages */
+    uint8_t *wb;                /**< write-back buffer of one sector */
+    unsigned numof;             /**< number of @ref mtd_cache_t::entries */
+    uint32_t clock;             /**< LRU clock */
+    uint32_t wb_sector;         /**< sector of the pending writes */
+    uint32_t wb_start;          /**< start of the pending writes in the sector */
+    uint32_t wb_end;            /**< end of the pending writes in the sector */
+    mtd_cache_stats_t stats;    /**< statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Page cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Writes pending writes to the parent
+ *
+ * @param[in] cache     the cache
+ *
+ * @return  0 on success
+ * @return  < 0 on error, see @ref mtd_write_page_raw(). The pending writes are
+ *          discarded in that case.
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+/**
+ * @brief   Drops all cached pages
+ *
+ * Pending writes are kept.
+ *
+ * @param[in] cache     the cache
+ */
+void mtd_cache_invalidate(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -294,6 +294,17 @@ typedef struct netdev netdev_t;
  */
 typedef void (*netdev_event_cb_t)(netdev_t *dev, netdev_event_t event);
 
+/**
+ * @brief   Buffer allocator for @ref netdev_driver_t::recv_loan
+ *
+ * @param[in] ctx           context passed to netdev_driver_t::recv_loan
+ * @param[in] len           exact size of the received frame
+ *
+ * @return  buffer of at least @p len bytes the frame is written to
+ * @retval  NULL if the frame is to be dropped
+ */
+typedef void *(*netdev_recv_alloc_t)(void *ctx, size_t len);
+
 /**
  * @brief   Driver types for netdev.
  *
@@ -592,6 +603,41 @@ typedef struct netdev_driver {
      */
     int (*set)(netdev_t *dev, netopt_t opt,
                const void *value, size_t value_len);
+
+    /**
+     * @brief   Get a received frame into a buffer provided by the upper layer
+     *
+     * @pre     `(dev != NULL) && (alloc != NULL)`
+     *
+     * Supposed to be called from
+     * @ref netdev_t::event_callback "netdev->event_callback()" instead of
+     * netdev_driver_t::recv. Once the driver knows the exact size of the
+     * received frame, it calls @p alloc exactly once with that size and
+     * writes the frame directly into the returned buffer, which saves the
+     * upper layer the length query and having to shrink a buffer allocated
+     * for an upper bound estimation.
+     *
+     * If @p alloc returns NULL, the frame is dropped.
+     *
+     * Drivers that do not support this leave it as `NULL`, upper layers then
+     * use netdev_driver_t::recv.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[in]   alloc   allocator for the frame buffer
+     * @param[in]   ctx     context passed to @p alloc
+     * @param[out]  info    status information for the received frame. Might
+     *                      be of different type for different netdev devices.
+     *                      May be NULL if not needed or applicable.
+     *
+     * @return  number of bytes written to the buffer returned by @p alloc
+     * @retval  0       no frame was received, @p alloc was possibly called
+     *                  and the buffer must be disposed by the caller
+     * @retval  -ENOBUFS    @p alloc returned NULL, the frame was dropped
+     * @retval  <0      other error, the buffer returned by @p alloc (if any)
+     *                  must be disposed by the caller
+     */
+    int (*recv_loan)(netdev_t *dev, netdev_recv_alloc_t alloc, void *ctx,
+                     void *info);
 } netdev_driver_t;
 
 /**
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD access implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "list.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static char _stack[MTD_ASYNC_STACKSIZE];
+static event_queue_t _queue;
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static mutex_t _lock = MUTEX_INIT;
+
+static mtd_async_req_t *_req(list_node_t *node)
+{
+    return container_of(node, mtd_async_req_t, node);
+}
+
+static uint32_t _first_sector(const mtd_dev_t *mtd, const mtd_async_req_t *req)
+{
+    if (req->op == MTD_ASYNC_ERASE) {
+        return req->page;
+    }
+    return (req->page + req->offset / mtd->page_size) / mtd->pages_per_sector;
+}
+
+static uint32_t _last_sector(const mtd_dev_t *mtd, const mtd_async_req_t *req)
+{
+    if (req->op == MTD_ASYNC_ERASE) {
+        return req->page + req->count - 1;
+    }
+    return (req->page + (req->offset + req->count - 1) / mtd->page_size) /
+           mtd->pages_per_sector;
+}
+
+static uint64_t _addr(const mtd_dev_t *mtd, const mtd_async_req_t *req)
+{
+    return (uint64_t)req->page * mtd->page_size + req->offset;
+}
+
+/* requests that must not be reordered */
+static bool _conflict(const mtd_dev_t *mtd, const mtd_async_req_t *a,
+                      const mtd_async_req_t *b)
+{
+    if ((a->op == MTD_ASYNC_READ) && (b->op == MTD_ASYNC_READ)) {
+        return false;
+    }
+    return (_first_sector(mtd, a) <= _last_sector(mtd, b)) &&
+           (_first_sector(mtd, b) <= _last_sector(mtd, a));
+}
+
+/* requests that can be executed as one MTD operation */
+static bool _mergeable(const mtd_dev_t *mtd, const mtd_async_req_t *a,
+                       const mtd_async_req_t *b)
+{
+    if (a->op != b->op) {
+        return false;
+    }
+    if (a->op == MTD_ASYNC_ERASE) {
+        return b->page == a->page + a->count;
+    }
+    return ((uint8_t *)a->buf + a->count == b->buf) &&
+           (_addr(mtd, a) + a->count == _addr(mtd, b));
+}
+
+static int _exec(mtd_dev_t *mtd, const mtd_async_req_t *req, uint32_t count)
+{
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        return mtd_read_page(mtd, req->buf, req->page, req->offset, count);
+    case MTD_ASYNC_WRITE:
+        return mtd_write_page_raw(mtd, req->buf, req->page, req->offset,
+                                  count);
+    case MTD_ASYNC_ERASE:
+        return mtd_erase_sector(mtd, req->page, count);
+    }
+    return -EINVAL;
+}
+
+static void _complete(mtd_async_req_t *req, int res)
+{
+    req->res = res;
+    if (req->cb) {
+        req->cb(req);
+    }
+    if (req->event) {
+        event_post(req->queue, req->event);
+    }
+}
+
+static void _handler(event_t *event)
+{
+    mtd_async_t *dev = container_of(event, mtd_async_t, event);
+    mtd_async_req_t *first, *last;
+    uint32_t count;
+    unsigned state;
+    int res;
+
+    state = irq_disable();
+    if (dev->queue.next == NULL) {
+        irq_restore(state);
+        return;
+    }
+    /* take the head of the queue and all requests merging with it */
+    first = _req(dev->queue.next);
+    last = first;
+    count = first->count;
+    while (last->node.next &&
+           _mergeable(dev->mtd, last, _req(last->node.next))) {
+        last = _req(last->node.next);
+        count += last->count;
+    }
+    dev->queue.next = last->node.next;
+    last->node.next = NULL;
+    irq_restore(state);
+
+    DEBUG("mtd_async: op %u, page %" PRIu32 ", offset %" PRIu32
+          ", count %" PRIu32 "\n", first->op, first->page, first->offset,
+          count);
+    res = _exec(dev->mtd, first, count);
+
+    for (list_node_t *node = &first->node, *next; node; node = next) {
+        /* the request may be reused in the callback */
+        next = node->next;
+        _complete(_req(node), res);
+    }
+
+    /* continue later, so requests to other devices are served too */
+    if (dev->queue.next) {
+        event_post(&_queue, &dev->event);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+void mtd_async_init(mtd_async_t *dev, mtd_dev_t *mtd)
+{
+    *dev = (mtd_async_t){ .mtd = mtd, .event.handler = _handler };
+
+    mutex_lock(&_lock);
+    if (_pid == KERNEL_PID_UNDEF) {
+        event_queue_init_detached(&_queue);
+        _pid = thread_create(_stack, sizeof(_stack), MTD_ASYNC_PRIO,
+                             THREAD_CREATE_STACKTEST, _worker, NULL,
+                             "mtd_async");
+    }
+    mutex_unlock(&_lock);
+}
+
+int mtd_async_submit(mtd_async_t *dev, mtd_async_req_t *req)
+{
+    const mtd_dev_t *mtd = dev->mtd;
+    list_node_t *pos = &dev->queue;
+    unsigned state;
+
+    if ((req->count == 0) || (req->op > MTD_ASYNC_ERASE)) {
+        return -EINVAL;
+    }
+    if ((_last_sector(mtd, req) >= mtd->sector_count) ||
+        (_last_sector(mtd, req) < _first_sector(mtd, req))) {
+        return -EOVERFLOW;
+    }
+    req->node.next = NULL;
+
+    state = irq_disable();
+    /* behind the last request it must not overtake ... */
+    for (list_node_t *node = dev->queue.next; node; node = node->next) {
+        if (_conflict(mtd, _req(node), req)) {
+            pos = node;
+        }
+    }
+    /* ... and after that in ascending sector order */
+    while (pos->next &&
+           (_first_sector(mtd, _req(pos->next)) <= _first_sector(mtd, req))) {
+        pos = pos->next;
+    }
+    list_add(pos, &req->node);
+    irq_restore(state);
+
+    event_post(&_queue, &dev->event);
+    return 0;
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD page cache implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define MIN(a, b) ((a) > (b) ? (b) : (a))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+static bool _wb_pending(const mtd_cache_t *cache)
+{
+    return cache->wb_end > cache->wb_start;
+}
+
+static uint8_t *_data(mtd_cache_t *cache, const mtd_cache_entry_t *entry)
+{
+    return cache->pages + (entry - cache->entries) * cache->mtd.page_size;
+}
+
+static mtd_cache_entry_t *_lookup(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < cache->numof; i++) {
+        if (cache->entries[i].page == page) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static mtd_cache_entry_t *_victim(mtd_cache_t *cache)
+{
+    mtd_cache_entry_t *victim = &cache->entries[0];
+
+    for (unsigned i = 0; i < cache->numof; i++) {
+        mtd_cache_entry_t *entry = &cache->entries[i];
+
+        if (entry->page == MTD_CACHE_PAGE_INVALID) {
+            return entry;
+        }
+        /* wraparound safe: the oldest entry has the largest age */
+        if ((cache->clock - entry->last_use) >
+            (cache->clock - victim->last_use)) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+static void _touch(mtd_cache_t *cache, mtd_cache_entry_t *entry)
+{
+    entry->last_use = ++cache->clock;
+}
+
+/* applies pending writes to data read from the parent */
+static void _overlay_wb(mtd_cache_t *cache, uint8_t *dst, uint32_t page,
+                        uint32_t offset, uint32_t count)
+{
+    uint32_t pps = cache->mtd.pages_per_sector;
+    uint32_t start, end;
+
+    if (!_wb_pending(cache) || (page / pps != cache->wb_sector)) {
+        return;
+    }
+    start = (page % pps) * cache->mtd.page_size + offset;
+    end = start + count;
+    if ((start >= cache->wb_end) || (end <= cache->wb_start)) {
+        return;
+    }
+    memcpy(dst + (MAX(start, cache->wb_start) - start),
+           cache->wb + MAX(start, cache->wb_start),
+           MIN(end, cache->wb_end) - MAX(start, cache->wb_start));
+}
+
+static int _flush(mtd_cache_t *cache)
+{
+    int res;
+
+    if (!_wb_pending(cache)) {
+        return 0;
+    }
+    DEBUG("mtd_cache: flush sector %" PRIu32 " [%" PRIu32 ", %" PRIu32 ")\n",
+          cache->wb_sector, cache->wb_start, cache->wb_end);
+    res = mtd_write_page_raw(cache->parent, cache->wb + cache->wb_start,
+                             cache->wb_sector * cache->mtd.pages_per_sector,
+                             cache->wb_start, cache->wb_end - cache->wb_start);
+    cache->wb_start = 0;
+    cache->wb_end = 0;
+    cache->stats.flushes++;
+    return res;
+}
+
+static void _invalidate(mtd_cache_t *cache, uint32_t first, uint32_t num)
+{
+    for (unsigned i = 0; i < cache->numof; i++) {
+        if ((cache->entries[i].page - first) < num) {
+            cache->entries[i].page = MTD_CACHE_PAGE_INVALID;
+        }
+    }
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+void mtd_cache_invalidate(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    _invalidate(cache, 0, MTD_CACHE_PAGE_INVALID);
+    mutex_unlock(&cache->lock);
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = mtd_init(cache->parent);
+
+    if (res < 0) {
+        return res;
+    }
+
+    mutex_lock(&cache->lock);
+    mtd->sector_count = cache->parent->sector_count;
+    mtd->pages_per_sector = cache->parent->pages_per_sector;
+    mtd->page_size = cache->parent->page_size;
+    cache->clock = 0;
+    cache->wb_start = 0;
+    cache->wb_end = 0;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    _invalidate(cache, 0, MTD_CACHE_PAGE_INVALID);
+    mutex_unlock(&cache->lock);
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    /* only reads within a page are cached, larger reads would thrash the
+     * cache */
+    bool allocate = (offset + count) <= mtd->page_size;
+    mtd_cache_entry_t *entry;
+    int res = 0;
+
+    if (page >= mtd->sector_count * mtd->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+    entry = _lookup(cache, page);
+    if (entry) {
+        cache->stats.hits++;
+    }
+    else {
+        cache->stats.misses++;
+        if (!allocate || (cache->numof == 0)) {
+            res = mtd_read_page(cache->parent, dest, page, offset, count);
+            if (res == 0) {
+                _overlay_wb(cache, dest, page, offset, count);
+            }
+            goto out;
+        }
+        entry = _victim(cache);
+        entry->page = MTD_CACHE_PAGE_INVALID;
+        res = mtd_read_page(cache->parent, _data(cache, entry), page, 0,
+                            mtd->page_size);
+        if (res < 0) {
+            goto out;
+        }
+        entry->page = page;
+        _overlay_wb(cache, _data(cache, entry), page, 0, mtd->page_size);
+    }
+    _touch(cache, entry);
+    memcpy(dest, _data(cache, entry) + offset, count);
+
+out:
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t pps = mtd->pages_per_sector;
+    uint32_t sector = page / pps;
+    uint32_t start, end;
+    mtd_cache_entry_t *entry;
+    int res = 0;
+
+    if (page >= mtd->sector_count * pps) {
+        return -EOVERFLOW;
+    }
+    count = MIN(count, mtd->page_size - offset);
+    start = (page % pps) * mtd->page_size + offset;
+    end = start + count;
+
+    mutex_lock(&cache->lock);
+    if (cache->wb == NULL) {
+        res = mtd_write_page_raw(cache->parent, src, page, offset, count);
+        if (res < 0) {
+            goto out;
+        }
+    }
+    else {
+        if (_wb_pending(cache)) {
+            if ((sector == cache->wb_sector) &&
+                (start <= cache->wb_end) && (end >= cache->wb_start)) {
+                cache->stats.merged++;
+                start = MIN(start, cache->wb_start);
+                end = MAX(end, cache->wb_end);
+            }
+            else if ((res = _flush(cache)) < 0) {
+                goto out;
+            }
+        }
+        memcpy(cache->wb + (page % pps) * mtd->page_size + offset, src, count);
+        cache->wb_sector = sector;
+        cache->wb_start = start;
+        cache->wb_end = end;
+    }
+    /* keep a cached copy of the page coherent */
+    entry = _lookup(cache, page);
+    if (entry) {
+        memcpy(_data(cache, entry) + offset, src, count);
+    }
+
+out:
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t pps = mtd->pages_per_sector;
+
+    mutex_lock(&cache->lock);
+    if (_wb_pending(cache) && ((cache->wb_sector - sector) < count)) {
+        /* no point in writing what gets erased anyway */
+        cache->wb_start = 0;
+        cache->wb_end = 0;
+    }
+    _invalidate(cache, sector * pps, count * pps);
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    if (power == MTD_POWER_DOWN) {
+        res = _flush(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+};
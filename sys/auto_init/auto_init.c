@@ -54,6 +54,11 @@ void auto_init(void)
         extern void init_schedstatistics(void);
         init_schedstatistics();
     }
+    if (IS_USED(MODULE_SCHED_PROFILER)) {
+        LOG_DEBUG("Auto init sched_profiler.\n");
+        extern void sched_profiler_init(void);
+        sched_profiler_init();
+    }
     if (IS_USED(MODULE_SCHED_ROUND_ROBIN)) {
         LOG_DEBUG("Auto init sched_round_robin.\n");
         extern void sched_round_robin_init(void);
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stddef.h>
+
+#include "clist.h"
+#include "congure/cocoa.h"
+
+/* bounds of the RTO for the variable backoff factor and aging */
+#define RTO_SMALL_MS    (1000U)
+#define RTO_LARGE_MS    (3000U)
+
+/* samples of exchanges with more retransmissions are ambiguous */
+#define WEAK_RESENDS_MAX    (2U)
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    /* losses are only detected by timeouts with CoAP */
+    .report_msgs_lost = _snd_report_msgs_timeout,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+void congure_cocoa_snd_setup(congure_cocoa_snd_t *c,
+                             const congure_cocoa_snd_consts_t *consts)
+{
+    c->super.driver = &_driver;
+    c->consts = consts;
+}
+
+static uint32_t _bound(uint32_t rto)
+{
+    if (rto == 0) {
+        return 1;
+    }
+    return (rto > CONGURE_COCOA_RTO_MAX_MS) ? CONGURE_COCOA_RTO_MAX_MS : rto;
+}
+
+uint32_t congure_cocoa_snd_rto(congure_cocoa_snd_t *c, ztimer_now_t now)
+{
+    uint32_t age = now - c->rto_time;
+
+    if ((c->rto < RTO_SMALL_MS) && (age >= 16 * c->rto)) {
+        c->rto = _bound(2 * c->rto);
+        c->rto_time = now;
+    }
+    else if ((c->rto > RTO_LARGE_MS) && (age >= 4 * c->rto)) {
+        c->rto = (c->consts->init_rto + c->rto) / 2;
+        c->rto_time = now;
+    }
+    return c->rto;
+}
+
+uint32_t congure_cocoa_snd_backoff(uint32_t rto, uint32_t timeout)
+{
+    if (rto < RTO_SMALL_MS) {
+        timeout *= 3;
+    }
+    else if (rto > RTO_LARGE_MS) {
+        timeout += timeout / 2;
+    }
+    else {
+        timeout *= 2;
+    }
+    return _bound(timeout);
+}
+
+/* RFC 6298, section 2 with K = k */
+static void _estimate(congure_cocoa_estimator_t *e, uint32_t rtt, unsigned k)
+{
+    if (e->rto == 0) {
+        e->srtt = rtt;
+        e->rttvar = rtt / 2;
+    }
+    else {
+        uint32_t delta = (e->srtt > rtt) ? (e->srtt - rtt) : (rtt - e->srtt);
+
+        e->rttvar = (3 * e->rttvar + delta) / 4;
+        e->srtt = (7 * e->srtt + rtt) / 8;
+    }
+    e->rto = _bound(e->srtt + k * e->rttvar);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->super.cwnd = c->consts->nstart;
+    c->in_flight = 0;
+    c->strong.rto = 0;
+    c->weak.rto = 0;
+    c->rto = _bound(c->consts->init_rto);
+    c->rto_time = 0;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+
+    c->in_flight += msg_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+
+    c->in_flight = (c->in_flight > msg_size) ? (c->in_flight - msg_size) : 0;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_snd_msg_t *msg = msgs;
+
+    /* the RTO is only updated by samples, the backoff is up to the user */
+    do {
+        msg = (congure_snd_msg_t *)msg->super.next;
+        _snd_report_msg_discarded(cong, msg->size);
+    } while (msg != msgs);
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_cocoa_snd_t *c = (congure_cocoa_snd_t *)cong;
+    uint32_t rtt = ack->recv_time - msg->send_time;
+
+    _snd_report_msg_discarded(cong, msg->size);
+    if (msg->resends == 0) {
+        _estimate(&c->strong, rtt, 4);
+        c->rto = _bound((c->strong.rto + c->rto) / 2);
+    }
+    else if (msg->resends <= WEAK_RESENDS_MAX) {
+        _estimate(&c->weak, rtt, 1);
+        c->rto = _bound((c->weak.rto + 3 * c->rto) / 4);
+    }
+    else {
+        /* the sample is too ambiguous */
+        return;
+    }
+    c->rto_time = ack->recv_time;
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)cong;
+    (void)time;
+}
+
+/** @} */
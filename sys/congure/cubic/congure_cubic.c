@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stddef.h>
+
+#include "congure/cubic.h"
+
+/* limit for t - K in ms, keeps the cubic term in 64 bit */
+#define DELTA_MAX       (60000)
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+void congure_cubic_snd_setup(congure_cubic_snd_t *c,
+                             const congure_cubic_snd_consts_t *consts)
+{
+    c->super.driver = &_driver;
+    c->consts = consts;
+}
+
+static congure_wnd_size_t _bound(const congure_cubic_snd_t *c, int64_t cwnd)
+{
+    if (cwnd < c->consts->cwnd_lower) {
+        return c->consts->cwnd_lower;
+    }
+    if (cwnd > c->consts->cwnd_upper) {
+        return c->consts->cwnd_upper;
+    }
+    return cwnd;
+}
+
+static uint32_t _cbrt(uint64_t x)
+{
+    uint32_t lo = 0;
+    uint32_t hi = 1U << 21;     /* (2^21)^3 > 2^63 */
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi + 1) / 2;
+
+        if ((uint64_t)mid * mid * mid <= x) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+/* RFC 8312, equation (2): K = cbrt(W_max * (1 - beta) / C), in ms */
+static uint32_t _k(const congure_cubic_snd_t *c)
+{
+    uint64_t diff = c->w_max - c->super.cwnd;
+
+    return _cbrt((diff * 1000000000000ULL) /
+                 ((uint64_t)c->consts->mss * c->consts->c));
+}
+
+/* RFC 8312, equation (1): W_cubic(t) = C * (t - K)^3 + W_max */
+static int64_t _w_cubic(const congure_cubic_snd_t *c, uint32_t t)
+{
+    int64_t delta = (int64_t)t - c->k;
+
+    if (delta > DELTA_MAX) {
+        delta = DELTA_MAX;
+    }
+    else if (delta < -DELTA_MAX) {
+        delta = -DELTA_MAX;
+    }
+    /* segments * 10^9 ... */
+    int64_t w = ((delta * delta * delta) / 1000) * c->consts->c;
+
+    /* ... to bytes */
+    return c->w_max + ((w / 1000) * c->consts->mss) / 1000000;
+}
+
+static void _reduce(congure_cubic_snd_t *c)
+{
+    uint32_t cwnd = c->super.cwnd;
+    uint32_t ssthresh = (cwnd * c->consts->beta) / CONGURE_CUBIC_BETA_SCALE;
+
+    c->epoch_started = false;
+    /* RFC 8312, section 4.6 */
+    if (c->consts->fast_convergence && (cwnd < c->w_max)) {
+        c->w_max = (cwnd * (CONGURE_CUBIC_BETA_SCALE + c->consts->beta)) /
+                   (2 * CONGURE_CUBIC_BETA_SCALE);
+    }
+    else {
+        c->w_max = cwnd;
+    }
+    if (ssthresh < 2U * c->consts->mss) {
+        ssthresh = 2U * c->consts->mss;
+    }
+    c->ssthresh = _bound(c, ssthresh);
+}
+
+static void _congestion_avoidance(congure_cubic_snd_t *c, unsigned size,
+                                  ztimer_now_t now)
+{
+    uint32_t cwnd = c->super.cwnd;
+    int64_t target;
+
+    if (!c->epoch_started) {
+        c->epoch_started = true;
+        c->epoch_start = now;
+        c->ca_acked = 0;
+        c->est_acked = 0;
+        c->w_est = cwnd;
+        if (cwnd < c->w_max) {
+            c->k = _k(c);
+        }
+        else {
+            c->k = 0;
+            c->w_max = cwnd;
+        }
+    }
+
+    /* RFC 8312, section 4.2: TCP-friendly region, the window Reno would have
+     * with the same reduction factor */
+    c->est_acked += size * 3U * (CONGURE_CUBIC_BETA_SCALE - c->consts->beta);
+    while (c->est_acked >= cwnd * (CONGURE_CUBIC_BETA_SCALE + c->consts->beta)) {
+        c->est_acked -= cwnd * (CONGURE_CUBIC_BETA_SCALE + c->consts->beta);
+        c->w_est = _bound(c, c->w_est + c->consts->mss);
+    }
+
+    /* RFC 8312, sections 4.3 and 4.4: concave and convex region */
+    target = _w_cubic(c, (now - c->epoch_start) + c->rtt);
+    if (target > (int64_t)(cwnd + cwnd / 2)) {
+        target = cwnd + cwnd / 2;
+    }
+    if (target < c->w_est) {
+        c->super.cwnd = c->w_est;
+        c->ca_acked = 0;
+    }
+    else if (target > cwnd) {
+        uint32_t inc;
+
+        c->ca_acked += size;
+        inc = ((target - cwnd) * c->ca_acked) / cwnd;
+        if (inc > 0) {
+            c->super.cwnd = _bound(c, cwnd + inc);
+            c->ca_acked = 0;
+        }
+    }
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->super.cwnd = _bound(c, c->consts->init_cwnd);
+    c->ssthresh = c->consts->init_ssthresh;
+    c->in_flight = 0;
+    c->w_max = 0;
+    c->w_est = 0;
+    c->k = 0;
+    c->rtt = 0;
+    c->ca_acked = 0;
+    c->est_acked = 0;
+    c->epoch_started = false;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->in_flight += msg_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    c->in_flight = (c->in_flight > msg_size) ? (c->in_flight - msg_size) : 0;
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    (void)msgs;
+    _reduce(c);
+    c->super.cwnd = c->ssthresh;
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    (void)msgs;
+    _reduce(c);
+    c->super.cwnd = _bound(c, c->consts->mss);
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_cubic_snd_t *c = (congure_cubic_snd_t *)cong;
+
+    _snd_report_msg_discarded(cong, msg->size);
+    /* Karn's algorithm: no RTT samples from resent messages */
+    if (msg->resends == 0) {
+        c->rtt = ack->recv_time - msg->send_time;
+    }
+    if (c->super.cwnd < c->ssthresh) {
+        c->super.cwnd = _bound(c, c->super.cwnd +
+                               ((msg->size < c->consts->mss) ? msg->size
+                                                             : c->consts->mss));
+    }
+    else {
+        _congestion_avoidance(c, msg->size, ack->recv_time);
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    _snd_report_msgs_lost(cong, NULL);
+}
+
+/** @} */
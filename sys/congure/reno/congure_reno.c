@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stddef.h>
+
+#include "congure/reno.h"
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+void congure_reno_snd_setup(congure_reno_snd_t *c,
+                            const congure_reno_snd_consts_t *consts)
+{
+    c->super.driver = &_driver;
+    c->consts = consts;
+}
+
+static congure_wnd_size_t _bound(const congure_reno_snd_t *c, uint32_t cwnd)
+{
+    if (cwnd < c->consts->cwnd_lower) {
+        return c->consts->cwnd_lower;
+    }
+    if (cwnd > c->consts->cwnd_upper) {
+        return c->consts->cwnd_upper;
+    }
+    return cwnd;
+}
+
+static void _set_ssthresh(congure_reno_snd_t *c)
+{
+    /* RFC 5681, equation (4) */
+    uint32_t ssthresh = c->in_flight / 2;
+
+    if (ssthresh < 2U * c->consts->mss) {
+        ssthresh = 2U * c->consts->mss;
+    }
+    c->ssthresh = (ssthresh > CONGURE_WND_SIZE_MAX) ? CONGURE_WND_SIZE_MAX
+                                                    : ssthresh;
+    c->ca_acked = 0;
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->super.cwnd = _bound(c, c->consts->init_cwnd);
+    c->ssthresh = c->consts->init_ssthresh;
+    c->in_flight = 0;
+    c->ca_acked = 0;
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight += msg_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    c->in_flight = (c->in_flight > msg_size) ? (c->in_flight - msg_size) : 0;
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    _set_ssthresh(c);
+    c->super.cwnd = _bound(c, c->ssthresh);
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+
+    (void)msgs;
+    _set_ssthresh(c);
+    /* RFC 5681: loss window is one segment */
+    c->super.cwnd = _bound(c, c->consts->mss);
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_reno_snd_t *c = (congure_reno_snd_t *)cong;
+    uint32_t cwnd = c->super.cwnd;
+
+    (void)ack;
+    _snd_report_msg_discarded(cong, msg->size);
+    /* slow start: grow by the acknowledged data, at most one segment */
+    if (cwnd < c->ssthresh) {
+        cwnd += (msg->size < c->consts->mss) ? msg->size : c->consts->mss;
+    }
+    /* congestion avoidance: grow by one segment per window */
+    else {
+        c->ca_acked += msg->size;
+        if (c->ca_acked >= cwnd) {
+            c->ca_acked -= cwnd;
+            cwnd += c->consts->mss;
+        }
+    }
+    c->super.cwnd = _bound(c, cwnd);
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    _snd_report_msgs_lost(cong, NULL);
+}
+
+/** @} */
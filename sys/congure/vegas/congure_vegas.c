@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stddef.h>
+
+#include "congure/vegas.h"
+
+static void _snd_init(congure_snd_t *cong, void *ctx);
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size);
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs);
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs);
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack);
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time);
+
+static const congure_snd_driver_t _driver = {
+    .init = _snd_init,
+    .inter_msg_interval = _snd_inter_msg_interval,
+    .report_msg_sent = _snd_report_msg_sent,
+    .report_msg_discarded = _snd_report_msg_discarded,
+    .report_msgs_timeout = _snd_report_msgs_timeout,
+    .report_msgs_lost = _snd_report_msgs_lost,
+    .report_msg_acked = _snd_report_msg_acked,
+    .report_ecn_ce = _snd_report_ecn_ce,
+};
+
+void congure_vegas_snd_setup(congure_vegas_snd_t *c,
+                             const congure_vegas_snd_consts_t *consts)
+{
+    c->super.driver = &_driver;
+    c->consts = consts;
+}
+
+static congure_wnd_size_t _bound(const congure_vegas_snd_t *c, uint32_t cwnd)
+{
+    if (cwnd < c->consts->cwnd_lower) {
+        return c->consts->cwnd_lower;
+    }
+    if (cwnd > c->consts->cwnd_upper) {
+        return c->consts->cwnd_upper;
+    }
+    return cwnd;
+}
+
+static void _new_round(congure_vegas_snd_t *c)
+{
+    c->round_rtt = 0;
+    c->round_acked = 0;
+    c->round_wnd = c->super.cwnd;
+}
+
+/* evaluates the last round, called once per round trip */
+static void _adjust(congure_vegas_snd_t *c)
+{
+    uint32_t cwnd = c->super.cwnd;
+    uint32_t mss = c->consts->mss;
+    /* data queued in the network: cwnd * (1 - base_rtt / rtt) */
+    uint32_t diff = ((uint64_t)cwnd * (c->round_rtt - c->base_rtt)) /
+                    c->round_rtt;
+
+    if (cwnd < c->ssthresh) {
+        if (diff > c->consts->gamma * mss) {
+            /* leave slow start, undo the overshoot of the last round */
+            cwnd -= diff / 2;
+            c->ssthresh = _bound(c, cwnd);
+        }
+    }
+    else if (diff < c->consts->alpha * mss) {
+        cwnd += mss;
+    }
+    else if (diff > c->consts->beta * mss) {
+        cwnd -= (cwnd > mss) ? mss : 0;
+        /* stay in congestion avoidance */
+        c->ssthresh = _bound(c, cwnd);
+    }
+    c->super.cwnd = _bound(c, cwnd);
+}
+
+static void _snd_init(congure_snd_t *cong, void *ctx)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+
+    c->super.ctx = ctx;
+    c->super.cwnd = _bound(c, c->consts->init_cwnd);
+    c->ssthresh = c->consts->init_ssthresh;
+    c->in_flight = 0;
+    c->base_rtt = 0;
+    _new_round(c);
+}
+
+static int32_t _snd_inter_msg_interval(congure_snd_t *cong, unsigned msg_size)
+{
+    (void)cong;
+    (void)msg_size;
+    return -1;
+}
+
+static void _snd_report_msg_sent(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+
+    c->in_flight += msg_size;
+}
+
+static void _snd_report_msg_discarded(congure_snd_t *cong, unsigned msg_size)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+
+    c->in_flight = (c->in_flight > msg_size) ? (c->in_flight - msg_size) : 0;
+}
+
+static void _snd_report_msgs_lost(congure_snd_t *cong, congure_snd_msg_t *msgs)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+
+    (void)msgs;
+    c->super.cwnd = _bound(c, (c->super.cwnd * 3U) / 4U);
+    c->ssthresh = c->super.cwnd;
+    _new_round(c);
+}
+
+static void _snd_report_msgs_timeout(congure_snd_t *cong,
+                                     congure_snd_msg_t *msgs)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+    uint32_t ssthresh = c->in_flight / 2;
+
+    (void)msgs;
+    if (ssthresh < 2U * c->consts->mss) {
+        ssthresh = 2U * c->consts->mss;
+    }
+    c->ssthresh = _bound(c, ssthresh);
+    c->super.cwnd = _bound(c, c->consts->mss);
+    /* the path may have changed, measure the base RTT again */
+    c->base_rtt = 0;
+    _new_round(c);
+}
+
+static void _snd_report_msg_acked(congure_snd_t *cong, congure_snd_msg_t *msg,
+                                  congure_snd_ack_t *ack)
+{
+    congure_vegas_snd_t *c = (congure_vegas_snd_t *)cong;
+
+    _snd_report_msg_discarded(cong, msg->size);
+
+    /* Karn's algorithm: no RTT samples from resent messages */
+    if (msg->resends == 0) {
+        uint32_t rtt = ack->recv_time - msg->send_time;
+
+        /* timer resolution, 0 is used as "unknown" */
+        if (rtt == 0) {
+            rtt = 1;
+        }
+        if ((c->base_rtt == 0) || (rtt < c->base_rtt)) {
+            c->base_rtt = rtt;
+        }
+        if ((c->round_rtt == 0) || (rtt < c->round_rtt)) {
+            c->round_rtt = rtt;
+        }
+    }
+
+    /* slow start grows on every ACK, the RTT check ends it */
+    if (c->super.cwnd < c->ssthresh) {
+        c->super.cwnd = _bound(c, c->super.cwnd +
+                               ((msg->size < c->consts->mss) ? msg->size
+                                                             : c->consts->mss));
+    }
+
+    /* a window of data was acknowledged: one round trip is over */
+    c->round_acked += msg->size;
+    if (c->round_acked >= c->round_wnd) {
+        if (c->round_rtt > 0) {
+            _adjust(c);
+        }
+        _new_round(c);
+    }
+}
+
+static void _snd_report_ecn_ce(congure_snd_t *cong, ztimer_now_t time)
+{
+    (void)time;
+    _snd_report_msgs_lost(cong, NULL);
+}
+
+/** @} */
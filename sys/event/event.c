@@ -56,6 +56,10 @@ void event_cancel(event_queue_t *queue, event_t *event)
 
     unsigned state = irq_disable();
     clist_remove(&queue->event_list, &event->list_node);
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    /* the event loop might have taken the event already */
+    clist_remove(&queue->batch, &event->list_node);
+#endif
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -72,6 +76,22 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
+size_t event_get_batch(event_queue_t *queue, event_t **events, size_t max)
+{
+    assert(queue && events);
+    size_t n = 0;
+    clist_node_t *node;
+
+    unsigned state = irq_disable();
+    while ((n < max) && (node = clist_lpop(&queue->event_list))) {
+        node->next = NULL;
+        events[n++] = container_of(node, event_t, list_node);
+    }
+    irq_restore(state);
+
+    return n;
+}
+
 event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
 {
     assert(queues && n_queues);
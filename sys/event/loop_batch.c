@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Batching event loop implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event.h"
+#include "clist.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+static event_queue_t *_wait_batch(event_queue_t *queues, size_t n_queues)
+{
+    while (1) {
+        unsigned state = irq_disable();
+        for (size_t i = 0; i < n_queues; i++) {
+            clist_node_t *node;
+            unsigned n = 0;
+
+            /* keep the batch on a list of the queue, so that event_cancel()
+             * can still remove events from it */
+            while ((n < CONFIG_EVENT_LOOP_BATCH_SIZE) &&
+                   (node = clist_lpop(&queues[i].event_list))) {
+                clist_rpush(&queues[i].batch, node);
+                n++;
+            }
+            if (n > 0) {
+                irq_restore(state);
+                return &queues[i];
+            }
+        }
+        irq_restore(state);
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+}
+
+void event_loop_batch_multi(event_queue_t *queues, size_t n_queues)
+{
+    assert(queues && n_queues);
+    while (1) {
+        event_queue_t *queue = _wait_batch(queues, n_queues);
+        clist_node_t *node;
+
+        do {
+            unsigned state = irq_disable();
+            node = clist_lpop(&queue->batch);
+            if (node) {
+                node->next = NULL;
+            }
+            irq_restore(state);
+            if (node) {
+                event_t *event = container_of(node, event_t, list_node);
+
+                event->handler(event);
+            }
+        } while (node);
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_cocoa   CongURE implementation of CoCoA
+ * @ingroup     sys_congure
+ * @brief       Implementation of the CoAP Simple Congestion Control/Advanced
+ *              (CoCoA) for the CongURE framework.
+ *
+ * CoCoA replaces the fixed initial retransmission timeout (RTO) of CoAP with
+ * an estimate from round trip time (RTT) samples (see [draft-ietf-core-cocoa]):
+ *
+ * - The *strong estimator* takes samples of exchanges that were answered
+ *   without retransmission, its RTO is `SRTT + 4 * RTTVAR` as in [RFC 6298].
+ * - The *weak estimator* takes samples of exchanges that were answered after
+ *   one or two retransmissions, measured from the first transmission. Its RTO
+ *   is `SRTT + RTTVAR`.
+ * - The overall RTO is moved halfway to the strong and a quarter of the way
+ *   to the weak RTO on each of their updates. It ages towards its default, if
+ *   it was not updated for a long time.
+ *
+ * Retransmissions back off by a variable factor that depends on the RTO the
+ * exchange started with, see congure_cocoa_snd_backoff().
+ *
+ * The window of this implementation is constant and bounds the number of
+ * outstanding messages, i.e. `NSTART` in CoAP terms. All messages are
+ * expected to be reported with a size of 1.
+ *
+ * [draft-ietf-core-cocoa]: https://tools.ietf.org/html/draft-ietf-core-cocoa-03
+ * [RFC 6298]: https://tools.ietf.org/html/rfc6298
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef CONGURE_COCOA_H
+#define CONGURE_COCOA_H
+
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Upper bound for all timeouts in milliseconds
+ */
+#define CONGURE_COCOA_RTO_MAX_MS    (60000U)
+
+/**
+ * @brief   Constants for the congestion control
+ */
+typedef struct {
+    congure_wnd_size_t nstart;  /**< number of outstanding messages */
+    uint32_t init_rto;          /**< RTO without samples in milliseconds */
+} congure_cocoa_snd_consts_t;
+
+/**
+ * @brief   State of an RTT estimator
+ */
+typedef struct {
+    uint32_t srtt;              /**< smoothed RTT in milliseconds */
+    uint32_t rttvar;            /**< RTT variation in milliseconds */
+    uint32_t rto;               /**< RTO in milliseconds, 0 without sample */
+} congure_cocoa_estimator_t;
+
+/**
+ * @brief   State object for CongURE CoCoA
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;                        /**< see @ref congure_snd_t */
+    const congure_cocoa_snd_consts_t *consts;   /**< constants */
+    congure_wnd_size_t in_flight;               /**< outstanding messages */
+    congure_cocoa_estimator_t strong;           /**< strong estimator */
+    congure_cocoa_estimator_t weak;             /**< weak estimator */
+    uint32_t rto;                               /**< overall RTO */
+    ztimer_now_t rto_time;      /**< time of the last update of the RTO */
+} congure_cocoa_snd_t;
+
+/**
+ * @brief   Sets up the driver for CongURE CoCoA object
+ *
+ * @param[in] c         A CongURE CoCoA object.
+ * @param[in] consts    The constants to use for @p c.
+ */
+void congure_cocoa_snd_setup(congure_cocoa_snd_t *c,
+                             const congure_cocoa_snd_consts_t *consts);
+
+/**
+ * @brief   Gets the RTO for the first transmission of a message
+ *
+ * Applies the aging of the overall RTO: An RTO below 1 s that was not updated
+ * for 16 RTOs is doubled, an RTO above 3 s that was not updated for 4 RTOs is
+ * moved halfway towards @ref congure_cocoa_snd_consts_t::init_rto.
+ *
+ * @param[in,out] c     A CongURE CoCoA object.
+ * @param[in] now       The current time in milliseconds.
+ *
+ * @return  The RTO in milliseconds.
+ */
+uint32_t congure_cocoa_snd_rto(congure_cocoa_snd_t *c, ztimer_now_t now);
+
+/**
+ * @brief   Gets the timeout for a retransmission
+ *
+ * The variable backoff factor is 3 for exchanges that started with an RTO
+ * below 1 s, 1.5 for an RTO above 3 s and 2 otherwise.
+ *
+ * @param[in] rto       The RTO the exchange started with in milliseconds, see
+ *                      congure_cocoa_snd_rto().
+ * @param[in] timeout   The timeout that expired in milliseconds.
+ *
+ * @return  The timeout for the retransmission in milliseconds.
+ */
+uint32_t congure_cocoa_snd_backoff(uint32_t rto, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_COCOA_H */
+/** @} */
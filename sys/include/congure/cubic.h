@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_cubic   CongURE implementation of CUBIC
+ * @ingroup     sys_congure
+ * @brief       Implementation of the CUBIC congestion control mechanism for
+ *              the CongURE framework.
+ *
+ * In congestion avoidance, the window follows a cubic function of the time
+ * since the last window reduction, which is centered at the window size
+ * before that reduction (see [RFC 8312]). The window thus quickly
+ * recovers to that size, stays close to it for a while and only then probes
+ * for more bandwidth. The window never grows slower than with TCP Reno
+ * ("TCP-friendly region").
+ *
+ * Slow start, the reaction to timeouts and the window bounds are the same as
+ * in @ref sys_congure_reno. The implementation uses integer arithmetic only,
+ * times are taken from @ref congure_snd_ack_t::recv_time in milliseconds.
+ *
+ * [RFC 8312]: https://tools.ietf.org/html/rfc8312
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef CONGURE_CUBIC_H
+#define CONGURE_CUBIC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Scaling factor of @ref congure_cubic_snd_consts_t::beta
+ */
+#define CONGURE_CUBIC_BETA_SCALE    (1024U)
+
+/**
+ * @brief   Constants for the congestion control
+ *
+ * All sizes are in the caller-defined unit of @ref congure_snd_msg_t::size,
+ * e.g. bytes for TCP.
+ */
+typedef struct {
+    congure_wnd_size_t mss;             /**< maximum segment size */
+    congure_wnd_size_t init_cwnd;       /**< initial congestion window */
+    congure_wnd_size_t init_ssthresh;   /**< initial slow start threshold */
+    congure_wnd_size_t cwnd_lower;      /**< lower bound for the window */
+    congure_wnd_size_t cwnd_upper;      /**< upper bound for the window */
+    /**
+     * @brief   Scaling constant C in segments per second³ times 1000,
+     *          RFC 8312 recommends 400
+     */
+    uint16_t c;
+    /**
+     * @brief   Window reduction factor in units of
+     *          1 / @ref CONGURE_CUBIC_BETA_SCALE, RFC 8312 recommends 717
+     */
+    uint16_t beta;
+    /**
+     * @brief   Release bandwidth faster to new flows, when the window
+     *          before a loss is smaller than before the previous one
+     */
+    bool fast_convergence;
+} congure_cubic_snd_consts_t;
+
+/**
+ * @brief   State object for CongURE CUBIC
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;                        /**< see @ref congure_snd_t */
+    const congure_cubic_snd_consts_t *consts;   /**< constants */
+    congure_wnd_size_t ssthresh;                /**< slow start threshold */
+    congure_wnd_size_t in_flight;               /**< unacknowledged data */
+    congure_wnd_size_t w_max;   /**< window before the last reduction */
+    congure_wnd_size_t w_est;   /**< window TCP Reno would have */
+    /**
+     * @brief   Start of the current congestion avoidance epoch in ms,
+     *          not started yet if @ref congure_cubic_snd_t::epoch_started is
+     *          false
+     */
+    ztimer_now_t epoch_start;
+    uint32_t k;                 /**< time to reach w_max again in ms */
+    uint32_t rtt;               /**< last round trip time in ms */
+    uint32_t ca_acked;          /**< data acknowledged, not yet accounted */
+    uint32_t est_acked;         /**< data acknowledged for w_est */
+    bool epoch_started;         /**< epoch_start is valid */
+} congure_cubic_snd_t;
+
+/**
+ * @brief   Sets up the driver for CongURE CUBIC object
+ *
+ * @param[in] c         A CongURE CUBIC object.
+ * @param[in] consts    The constants to use for @p c.
+ */
+void congure_cubic_snd_setup(congure_cubic_snd_t *c,
+                             const congure_cubic_snd_consts_t *consts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_CUBIC_H */
+/** @} */
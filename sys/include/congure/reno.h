@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_reno    CongURE implementation of TCP Reno
+ * @ingroup     sys_congure
+ * @brief       Implementation of the TCP Reno congestion control mechanism for
+ *              the CongURE framework.
+ *
+ * The window grows exponentially in slow start and by one maximum segment
+ * size per window of acknowledged data in congestion avoidance, counting the
+ * acknowledged bytes (see [RFC 5681] and [RFC 3465]). A loss halves the data
+ * in flight, a timeout additionally drops the window to its lower bound.
+ *
+ * Detection of lost messages, e.g. by duplicate ACKs or selective ACKs, and
+ * their retransmission is left to the user of this module.
+ *
+ * [RFC 3465]: https://tools.ietf.org/html/rfc3465
+ * [RFC 5681]: https://tools.ietf.org/html/rfc5681
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef CONGURE_RENO_H
+#define CONGURE_RENO_H
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Constants for the congestion control
+ *
+ * All sizes are in the caller-defined unit of @ref congure_snd_msg_t::size,
+ * e.g. bytes for TCP.
+ */
+typedef struct {
+    congure_wnd_size_t mss;             /**< maximum segment size */
+    congure_wnd_size_t init_cwnd;       /**< initial congestion window */
+    congure_wnd_size_t init_ssthresh;   /**< initial slow start threshold */
+    congure_wnd_size_t cwnd_lower;      /**< lower bound for the window */
+    congure_wnd_size_t cwnd_upper;      /**< upper bound for the window */
+} congure_reno_snd_consts_t;
+
+/**
+ * @brief   State object for CongURE Reno
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;                        /**< see @ref congure_snd_t */
+    const congure_reno_snd_consts_t *consts;    /**< constants */
+    congure_wnd_size_t ssthresh;                /**< slow start threshold */
+    congure_wnd_size_t in_flight;               /**< unacknowledged data */
+    /**
+     * @brief   Data acknowledged in congestion avoidance since the window
+     *          was increased the last time
+     */
+    uint32_t ca_acked;
+} congure_reno_snd_t;
+
+/**
+ * @brief   Sets up the driver for CongURE Reno object
+ *
+ * @param[in] c         A CongURE Reno object.
+ * @param[in] consts    The constants to use for @p c.
+ */
+void congure_reno_snd_setup(congure_reno_snd_t *c,
+                            const congure_reno_snd_consts_t *consts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_RENO_H */
+/** @} */
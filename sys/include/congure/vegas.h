@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_congure_vegas   CongURE implementation of TCP Vegas
+ * @ingroup     sys_congure
+ * @brief       Delay-based congestion control for the CongURE framework.
+ *
+ * TCP Vegas compares the throughput expected with the minimal round trip time
+ * observed to the throughput actually achieved and estimates the amount of
+ * data queued in the network from the difference. Once per round trip, the
+ * window is increased by one maximum segment size if less than
+ * @ref congure_vegas_snd_consts_t::alpha segments are queued and decreased if
+ * more than @ref congure_vegas_snd_consts_t::beta segments are queued. Slow
+ * start ends as soon as more than @ref congure_vegas_snd_consts_t::gamma
+ * segments are queued.
+ *
+ * This keeps the queues on multi-hop low-power links short, which lowers the
+ * round trip times and the losses due to queue overflows. Losses reduce the
+ * window to three quarters, timeouts to its lower bound.
+ *
+ * Round trip times are taken from acknowledged messages that were not
+ * resent, in milliseconds.
+ *
+ * @see L. S. Brakmo and L. L. Peterson, "TCP Vegas: End to End Congestion
+ *      Avoidance on a Global Internet", IEEE JSAC 13(8), 1995
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef CONGURE_VEGAS_H
+#define CONGURE_VEGAS_H
+
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Constants for the congestion control
+ *
+ * All sizes are in the caller-defined unit of @ref congure_snd_msg_t::size,
+ * e.g. bytes for TCP.
+ */
+typedef struct {
+    congure_wnd_size_t mss;             /**< maximum segment size */
+    congure_wnd_size_t init_cwnd;       /**< initial congestion window */
+    congure_wnd_size_t init_ssthresh;   /**< initial slow start threshold */
+    congure_wnd_size_t cwnd_lower;      /**< lower bound for the window */
+    congure_wnd_size_t cwnd_upper;      /**< upper bound for the window */
+    uint8_t alpha;  /**< queued segments below which the window grows */
+    uint8_t beta;   /**< queued segments above which the window shrinks */
+    uint8_t gamma;  /**< queued segments above which slow start ends */
+} congure_vegas_snd_consts_t;
+
+/**
+ * @brief   State object for CongURE Vegas
+ *
+ * @extends congure_snd_t
+ */
+typedef struct {
+    congure_snd_t super;                        /**< see @ref congure_snd_t */
+    const congure_vegas_snd_consts_t *consts;   /**< constants */
+    congure_wnd_size_t ssthresh;                /**< slow start threshold */
+    congure_wnd_size_t in_flight;               /**< unacknowledged data */
+    uint32_t base_rtt;      /**< minimal round trip time, 0 if unknown */
+    uint32_t round_rtt;     /**< minimal round trip time of this round */
+    uint32_t round_acked;   /**< data acknowledged in this round */
+    congure_wnd_size_t round_wnd;   /**< window at the start of this round */
+} congure_vegas_snd_t;
+
+/**
+ * @brief   Sets up the driver for CongURE Vegas object
+ *
+ * @param[in] c         A CongURE Vegas object.
+ * @param[in] consts    The constants to use for @p c.
+ */
+void congure_vegas_snd_setup(congure_vegas_snd_t *c,
+                             const congure_vegas_snd_consts_t *consts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_VEGAS_H */
+/** @} */
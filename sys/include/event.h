@@ -121,6 +121,18 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+/**
+ * @brief   Maximum number of events the event loop takes from a queue at once
+ *
+ * @note    Only applicable with the `event_loop_batch` module
+ *
+ * Events of higher priority queues posted while a batch is handled have to
+ * wait for up to this many events of a lower priority queue.
+ */
+#ifndef CONFIG_EVENT_LOOP_BATCH_SIZE
+#define CONFIG_EVENT_LOOP_BATCH_SIZE    (8U)
+#endif
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -154,6 +166,10 @@ struct event {
  */
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
+#if IS_USED(MODULE_EVENT_LOOP_BATCH) || defined(DOXYGEN)
+    clist_node_t batch;         /**< events taken by the event loop that
+                                     still wait for their handler       */
+#endif
     thread_t *waiter;           /**< thread owning event queue          */
 } event_queue_t;
 
@@ -287,6 +303,28 @@ void event_cancel(event_queue_t *queue, event_t *event);
  */
 event_t *event_get(event_queue_t *queue);
 
+/**
+ * @brief   Get up to @p max events from event queue, non-blocking
+ *
+ * This is equivalent to calling event_get() up to @p max times, but only
+ * disables interrupts once.
+ *
+ * In order to handle an event retrieved using this function,
+ * call events[i]->handler(events[i]).
+ *
+ * @note    The events are removed from @p queue at once. Cancelling one of
+ *          them with event_cancel() after this function returned has no
+ *          effect.
+ *
+ * @param[in]   queue   event queue to get events from
+ * @param[out]  events  array to store the events in
+ * @param[in]   max     maximum number of events to store in @p events
+ *
+ * @returns     number of events stored in @p events
+ * @returns     0 if no event available
+ */
+size_t event_get_batch(event_queue_t *queue, event_t **events, size_t max);
+
 /**
  * @brief   Get next event from the given event queues, blocking
  *
@@ -380,6 +418,27 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
                                    ztimer_clock_t *clock, uint32_t timeout);
 #endif
 
+#if IS_USED(MODULE_EVENT_LOOP_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Event loop with multiple queues that takes events in batches
+ *
+ * Like event_loop_multi(), but takes up to @ref CONFIG_EVENT_LOOP_BATCH_SIZE
+ * events from the highest priority queue containing events with interrupts
+ * disabled only once. Until its handler is called, an event of a batch is
+ * still considered queued: posting it again has no effect and it can be
+ * cancelled with event_cancel(). Once cancelled, the event is no longer
+ * accessed by the event loop, so it can be posted again or its memory can be
+ * reused.
+ *
+ * @note    Only available with the `event_loop_batch` module, which also makes
+ *          event_loop_multi() and event_loop() use this function.
+ *
+ * @param[in]   queues      Event queues to process
+ * @param[in]   n_queues    Number of queues passed with @p queues
+ */
+void event_loop_batch_multi(event_queue_t *queues, size_t n_queues);
+#endif
+
 /**
  * @brief   Simple event loop with multiple queues
  *
@@ -396,6 +455,9 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  *     }
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * With the `event_loop_batch` module, the events are taken in batches, see
+ * event_loop_batch_multi().
+ *
  * @see event_wait_multi
  *
  * @param[in]   queues      Event queues to process
@@ -403,11 +465,15 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  */
 static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
 {
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    event_loop_batch_multi(queues, n_queues);
+#else
     event_t *event;
 
     while ((event = event_wait_multi(queues, n_queues))) {
         event->handler(event);
     }
+#endif
 }
 
 /**
@@ -25,7 +25,7 @@
 #include <stdint.h>
 
 #include "mutex.h"
-#include "tsrb.h"
+#include "spscrb.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,15 +35,16 @@ extern "C" {
  * @brief   Context structure for isrpipe
  */
 typedef struct {
-    tsrb_t tsrb;        /**< isrpipe thread safe ringbuffer */
+    spscrb_t rb;        /**< isrpipe single-producer/single-consumer
+                             ringbuffer */
     mutex_t mutex;      /**< isrpipe mutex */
 } isrpipe_t;
 
 /**
  * @brief   Static initializer for irspipe
  */
-#define ISRPIPE_INIT(tsrb_buf) { .mutex = MUTEX_INIT, \
-                                 .tsrb = TSRB_INIT(tsrb_buf) }
+#define ISRPIPE_INIT(rb_buf) { .mutex = MUTEX_INIT, \
+                               .rb = SPSCRB_INIT(rb_buf) }
 
 /**
  * @brief   Initialisation function for isrpipe
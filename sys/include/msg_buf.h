@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_msg_buf Messages with buffer ownership
+ * @ingroup     sys
+ * @brief       Zero-copy message passing by transferring the ownership of
+ *              pool-allocated buffers
+ *
+ * A @ref msg_t can only carry a pointer or a 32-bit value, so larger payloads
+ * are either copied or passed by pointer with a convention of who is
+ * responsible for the memory. This module makes that convention explicit:
+ * Buffers are allocated from a @ref msg_buf_pool_t (backed by
+ * @ref sys_memarray) and always have exactly one owning thread.
+ * @ref msg_send_buf() hands a buffer over to the receiving thread together
+ * with the message, and the receiver gets the buffer with @ref msg_buf_get()
+ * and releases it with @ref msg_buf_free() (or passes it on).
+ *
+ * When a thread exits, all buffers it owns are returned to their pools,
+ * including those sent to it that are still waiting in its message queue.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static MSG_BUF_POOL_MEM(_mem, 128, 4);
+ * static msg_buf_pool_t _pool;
+ *
+ * msg_buf_pool_init(&_pool, _mem, 128, 4);
+ *
+ * // sender
+ * msg_t msg = { .type = MY_DATA };
+ * msg_buf_t *buf = msg_buf_alloc(&_pool);
+ * memcpy(msg_buf_data(buf), data, len);
+ * msg_send_buf(&msg, buf, receiver_pid);
+ *
+ * // receiver
+ * msg_receive(&msg);
+ * buf = msg_buf_get(&msg);
+ * process(msg_buf_data(buf));
+ * msg_buf_free(buf);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Messages with buffer ownership
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef MSG_BUF_H
+#define MSG_BUF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memarray.h"
+#include "msg.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct msg_buf_pool msg_buf_pool_t;
+
+/**
+ * @brief   Buffer header
+ *
+ * The payload follows the header directly.
+ */
+typedef struct {
+    void *reserved;             /**< free list pointer of the memarray */
+    msg_buf_pool_t *pool;       /**< pool the buffer belongs to */
+    kernel_pid_t owner;         /**< owning thread, KERNEL_PID_UNDEF if free */
+} msg_buf_t;
+
+/**
+ * @brief   Buffer pool
+ */
+struct msg_buf_pool {
+    memarray_t mem;             /**< free buffers */
+    msg_buf_pool_t *next;       /**< next registered pool */
+    uint8_t *data;              /**< memory of the pool */
+    size_t num;                 /**< number of buffers in the pool */
+};
+
+/**
+ * @brief   Size of a buffer of @p size payload bytes including its header
+ */
+#define MSG_BUF_SIZE(size)  ((sizeof(msg_buf_t) + (size) + sizeof(void *) - 1) & \
+                             ~(sizeof(void *) - 1))
+
+/**
+ * @brief   Defines the memory for a pool of @p num buffers of @p size bytes
+ */
+#define MSG_BUF_POOL_MEM(name, size, num) \
+    void *name[(MSG_BUF_SIZE(size) * (num)) / sizeof(void *)]
+
+/**
+ * @brief   Initializes and registers a buffer pool
+ *
+ * @param[out] pool     the pool
+ * @param[in] mem       memory defined with @ref MSG_BUF_POOL_MEM
+ * @param[in] size      payload size of a buffer
+ * @param[in] num       number of buffers in @p mem
+ */
+void msg_buf_pool_init(msg_buf_pool_t *pool, void *mem, size_t size,
+                       size_t num);
+
+/**
+ * @brief   Allocates a buffer owned by the calling thread
+ *
+ * @param[in] pool  the pool to allocate from
+ *
+ * @return  the buffer
+ * @return  NULL if the pool is exhausted
+ */
+msg_buf_t *msg_buf_alloc(msg_buf_pool_t *pool);
+
+/**
+ * @brief   Returns a buffer to its pool
+ *
+ * @param[in] buf   buffer owned by the calling thread
+ */
+void msg_buf_free(msg_buf_t *buf);
+
+/**
+ * @brief   Gets the payload of a buffer
+ *
+ * @param[in] buf   the buffer
+ *
+ * @return  the payload
+ */
+static inline void *msg_buf_data(msg_buf_t *buf)
+{
+    return buf + 1;
+}
+
+/**
+ * @brief   Sends a message transferring ownership of a buffer (blocking)
+ *
+ * Behaves like @ref msg_send(), with `content.ptr` of @p m pointing to
+ * @p buf. If the message could not be delivered, the calling thread keeps the
+ * buffer.
+ *
+ * @param[in] m             message to send
+ * @param[in] buf           buffer owned by the calling thread
+ * @param[in] target_pid    PID of the target thread
+ *
+ * @return  see @ref msg_send()
+ */
+int msg_send_buf(msg_t *m, msg_buf_t *buf, kernel_pid_t target_pid);
+
+/**
+ * @brief   Gets the buffer sent with a message
+ *
+ * @pre     @p m was received by the calling thread and sent with
+ *          @ref msg_send_buf()
+ *
+ * @param[in] m     received message
+ *
+ * @return  the buffer, now owned by the calling thread
+ */
+static inline msg_buf_t *msg_buf_get(const msg_t *m)
+{
+    return m->content.ptr;
+}
+
+/**
+ * @brief   Returns all buffers owned by a thread to their pools
+ *
+ * Called by the kernel when a thread exits.
+ *
+ * @param[in] pid   the thread
+ */
+void msg_buf_release_owned(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_BUF_H */
+/** @} */
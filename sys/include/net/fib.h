@@ -11,6 +11,21 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * Looking up the next hop for a destination searches all entries of a table.
+ * The `fib_index` pseudo-module adds an index to single hop tables instead:
+ * entries are hashed by their destination address, so exact matches, such as
+ * host routes, are found directly, and only prefixes and default routes are
+ * still searched. A small destination cache additionally remembers the
+ * results for the last few destinations. It is cleared whenever an entry is
+ * added or removed. Rather than on every lookup, expired entries are only
+ * removed once the earliest lifetime in the table passed.
+ *
+ * In source route tables, the module hashes all hops of all source routes by
+ * their address. Finding a route to a destination, or a partial route through
+ * it, as well as fib_sr_search() then only compare the addresses of the
+ * hops in one hash bucket. The index is rebuilt by the first search after a source route or
+ * one of its hops was created, changed or deleted.
+ *
  * @{
  *
  * @file
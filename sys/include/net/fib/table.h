@@ -19,8 +19,10 @@
 #ifndef NET_FIB_TABLE_H
 #define NET_FIB_TABLE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
 #include "sched.h"
 #include "universal_address.h"
 #include "mutex.h"
@@ -35,10 +37,29 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief   Number of hash buckets of the index of a FIB table as exponent of 2^n
+ *
+ * @note    Only used with the `fib_index` pseudo-module.
+ */
+#ifndef CONFIG_FIB_INDEX_SIZE_EXP
+#define CONFIG_FIB_INDEX_SIZE_EXP   (4U)
+#endif
+
+/**
+ * @brief   Number of destinations remembered by the destination cache of a
+ *          FIB table
+ *
+ * @note    Only used with the `fib_index` pseudo-module.
+ */
+#ifndef CONFIG_FIB_DC_NUMOF
+#define CONFIG_FIB_DC_NUMOF         (4U)
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,8 +72,31 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+#if IS_USED(MODULE_FIB_INDEX) || defined(DOXYGEN)
+    /** Next entry in the same hash bucket of the index */
+    struct fib_entry *index_next;
+    /** Next entry in the prefix list of the index */
+    struct fib_entry *index_pfx_next;
+#endif
 } fib_entry_t;
 
+#if IS_USED(MODULE_FIB_INDEX) || defined(DOXYGEN)
+/**
+ * @brief Destination cache entry of a FIB table
+ */
+typedef struct {
+    /** The entry found for fib_dc_entry_t::dst, NULL if unused */
+    fib_entry_t *entry;
+    /** The destination address */
+    uint8_t dst[UNIVERSAL_ADDRESS_SIZE];
+    /** Size in bytes of fib_dc_entry_t::dst */
+    uint8_t dst_size;
+    /** 1 if fib_dc_entry_t::entry is for exactly fib_dc_entry_t::dst,
+     *  0 if it is for a prefix of it */
+    uint8_t exact;
+} fib_dc_entry_t;
+#endif
+
 /**
 * @brief Container descriptor for a FIB source route entry
 */
@@ -61,12 +105,18 @@ typedef struct fib_sr_entry {
     universal_address_container_t *address;
     /** Pointer to the next shared generic address on the source route */
     struct fib_sr_entry *next;
+#if IS_USED(MODULE_FIB_INDEX) || defined(DOXYGEN)
+    /** Next hop in the same hash bucket of the index */
+    struct fib_sr_entry *index_next;
+    /** Source route this hop was on when the index was built */
+    struct fib_sr *index_sr;
+#endif
 } fib_sr_entry_t;
 
 /**
 * @brief Container descriptor for a FIB source route
 */
-typedef struct {
+typedef struct fib_sr {
     /** interface ID */
     kernel_pid_t sr_iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -133,6 +183,32 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if IS_USED(MODULE_FIB_INDEX) || defined(DOXYGEN)
+    union {
+        /** Hash buckets of all entries by their destination address.
+        *   Only used for tables of type @ref FIB_TABLE_TYPE_SH.
+        */
+        fib_entry_t *index[1U << CONFIG_FIB_INDEX_SIZE_EXP];
+        /** Hash buckets of all hops of all source routes by their address.
+        *   Only used for tables of type @ref FIB_TABLE_TYPE_SR.
+        */
+        fib_sr_entry_t *sr_index[1U << CONFIG_FIB_INDEX_SIZE_EXP];
+    };
+    /** false if a source route changed since fib_table_t::sr_index was built.
+    *   Only used for tables of type @ref FIB_TABLE_TYPE_SR.
+    */
+    bool sr_index_valid;
+    /** Entries that may match other destinations than their own,
+    *   i.e. prefixes and default routes, in table order
+    */
+    fib_entry_t *index_pfx;
+    /** Earliest lifetime of all entries, the table is swept for expired
+    *   entries once it passed
+    */
+    uint64_t index_expiry;
+    /** Cache of the last destinations looked up */
+    fib_dc_entry_t dc[CONFIG_FIB_DC_NUMOF];
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -38,6 +38,7 @@
  * - Observe Server Operation
  * - Block Operation
  * - Proxy Operation
+ * - Congestion Control
  * - DTLS for transport security
  * - Implementation Notes
  * - Implementation Status
@@ -355,6 +356,26 @@
  * are available the server destroys the session that has not been used for the
  * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_USEC.
  *
+ * ## Congestion Control ##
+ *
+ * By default, the retransmission timeout of a confirmable request starts at
+ * CONFIG_COAP_ACK_TIMEOUT_MS and doubles with each retransmission, regardless
+ * of the network conditions. With the module `gcoap_congure`, gcoap instead
+ * keeps a @ref sys_congure "CongURE" object per remote endpoint, which learns
+ * the round trip time of the exchanges with it (see @ref sys_congure_cocoa).
+ *
+ * - The initial retransmission timeout is estimated from the round trip times
+ *   of previous exchanges with the same endpoint and the backoff depends on
+ *   it, so requests to nearby endpoints are retransmitted earlier while a
+ *   congested path is not flooded with early retransmissions.
+ * - At most CONFIG_GCOAP_CONGURE_NSTART requests awaiting a response are sent
+ *   to the same endpoint. Further requests are dropped, i.e. gcoap_req_send()
+ *   returns 0, until a response arrives or the request times out.
+ *
+ * The state of up to CONFIG_GCOAP_CONGURE_REMOTES_MAX endpoints is kept. An
+ * endpoint without requests awaiting a response is replaced when a request to
+ * a new endpoint is sent, and its estimation is lost.
+ *
  * ## Implementation Notes ##
  *
  * ### Waiting for a response ###
@@ -406,6 +427,9 @@
 #endif
 #include "net/nanocoap.h"
 #include "timex.h"
+#if IS_USED(MODULE_GCOAP_CONGURE)
+#include "congure/cocoa.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -467,6 +491,25 @@ extern "C" {
 #ifndef CONFIG_GCOAP_REQ_WAITING_MAX
 #define CONFIG_GCOAP_REQ_WAITING_MAX   (2)
 #endif
+
+/**
+ * @brief   Maximum number of requests awaiting a response from the same
+ *          remote endpoint
+ *
+ * Only used with module `gcoap_congure`, NSTART in RFC 7252.
+ */
+#ifndef CONFIG_GCOAP_CONGURE_NSTART
+#define CONFIG_GCOAP_CONGURE_NSTART     (1)
+#endif
+
+/**
+ * @brief   Number of remote endpoints to keep congestion control state for
+ *
+ * Only used with module `gcoap_congure`.
+ */
+#ifndef CONFIG_GCOAP_CONGURE_REMOTES_MAX
+#define CONFIG_GCOAP_CONGURE_REMOTES_MAX    (CONFIG_GCOAP_REQ_WAITING_MAX)
+#endif
 /** @} */
 
 /**
@@ -790,6 +833,17 @@ typedef struct {
     size_t pdu_len;                     /**< Length of pdu_buf */
 } gcoap_resend_t;
 
+#if IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief   Congestion control state of a remote endpoint
+ */
+typedef struct {
+    sock_udp_ep_t remote;               /**< Remote endpoint, port 0 if unused */
+    congure_cocoa_snd_t congure;        /**< Congestion control */
+    uint32_t last_used;                 /**< Time of the last request in ms */
+} gcoap_congure_remote_t;
+#endif
+
 /**
  * @brief   Memo to handle a response for a request
  */
@@ -809,6 +863,17 @@ struct gcoap_request_memo {
     event_timeout_t resp_evt_tmout;     /**< Limits wait for response */
     event_callback_t resp_tmout_cb;     /**< Callback for response timeout */
     gcoap_socket_t socket;              /**< Transport type to remote endpoint */
+#if IS_USED(MODULE_GCOAP_CONGURE) || defined(DOXYGEN)
+    gcoap_congure_remote_t *congure;    /**< Congestion control of the remote
+                                             endpoint, NULL after the end of
+                                             the exchange was reported */
+    uint32_t send_time;                 /**< Time of the first transmission
+                                             in ms */
+    uint32_t rto;                       /**< RTO at the first transmission in
+                                             ms */
+    uint32_t timeout;                   /**< Current retransmission timeout in
+                                             ms */
+#endif
 };
 
 /**
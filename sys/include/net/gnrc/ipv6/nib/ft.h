@@ -10,6 +10,13 @@
  * @defgroup    net_gnrc_ipv6_nib_ft    Forwarding table
  * @ingroup     net_gnrc_ipv6_nib
  * @brief
+ *
+ * By default, route lookups search all off-link entries of the NIB linearly.
+ * For routers with many routes, e.g. a RPL root in non-storing mode, the
+ * `gnrc_ipv6_nib_ft_trie` pseudo-module indexes the entries in a prefix trie
+ * instead, so a lookup only takes a number of steps bound by the prefix
+ * length. This costs RAM for up to two trie nodes per off-link entry.
+ *
  * @{
  *
  * @file
@@ -10,6 +10,16 @@
  * @defgroup    net_gnrc_ipv6_nib_nc   Neighbor Cache
  * @ingroup     net_gnrc_ipv6_nib
  * @brief       Neighbor cache component of neighbor information base
+ *
+ * By default, looking up a neighbor searches all on-link entries of the NIB
+ * linearly, which happens for every packet sent. For nodes with many
+ * neighbors, e.g. a 6LBR with @ref CONFIG_GNRC_IPV6_NIB_NUMOF in the
+ * hundreds, the `gnrc_ipv6_nib_nc_hash` pseudo-module indexes the entries by
+ * a hash of their address instead, so a lookup only compares a few entries.
+ * When the neighbor cache is full, it also replaces the least recently looked
+ * up garbage-collectible entry instead of the oldest one. This costs RAM for
+ * two pointers and a 32-bit counter per entry.
+ *
  * @{
  *
  * @file
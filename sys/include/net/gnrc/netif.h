@@ -19,6 +19,16 @@
  * If you only have one network interface on the board, you can select the
  * `gnrc_netif_single` pseudo-module to enable further optimisations.
  *
+ * ## Batched transmission
+ *
+ * With the `gnrc_netif_batch` pseudo-module, several packets can be handed to
+ * an interface with a single message using @ref gnrc_netif_send_batch(). The
+ * interface thread then passes them to the device back-to-back, without
+ * returning to its message loop in between. Likewise, packets queued in
+ * @ref net_gnrc_netif_pktq are sent in one pass until the queue is empty or the
+ * device is busy again. 6LoWPAN fragmentation uses this to send all fragments
+ * of a datagram at once.
+ *
  * @{
  *
  * @file
@@ -648,6 +658,29 @@ static inline int gnrc_netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return gnrc_netapi_send(netif->pid, pkt);
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_BATCH) || DOXYGEN
+/**
+ * @brief   Send several GNRC packets via a given @ref gnrc_netif_t interface
+ *          at once.
+ *
+ * The packets are concatenated into one list of snips: each packet starts with
+ * its @ref GNRC_NETTYPE_NETIF header and its last snip points to the netif
+ * header of the next packet. The interface sends them in that order.
+ *
+ * @pre     All snips of @p pkts are exclusively owned by the caller (see
+ *          @ref gnrc_pktbuf_start_write()).
+ *
+ * @note    Only available with the `gnrc_netif_batch` pseudo-module.
+ *
+ * @param netif         pointer to the interface
+ * @param pkts          packets to be sent.
+ *
+ * @return              1 if the packets were successfully delivered
+ * @return              -1 on error
+ */
+int gnrc_netif_send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts);
+#endif
+
 #if defined(MODULE_GNRC_NETIF_BUS) || DOXYGEN
 /**
  * @brief   Get a message bus of a given @ref gnrc_netif_t interface.
@@ -45,6 +45,12 @@ extern "C" {
  */
 #define NETDEV_MSG_TYPE_EVENT           (0x1234)
 
+/**
+ * @brief   Message type to send a batch of packets, see
+ *          @ref gnrc_netif_send_batch()
+ */
+#define GNRC_NETIF_BATCH_MSG            (0x1235)
+
 /**
  * @brief   Acquires exclusive access to the interface
  *
@@ -63,6 +69,29 @@ void gnrc_netif_acquire(gnrc_netif_t *netif);
  */
 void gnrc_netif_release(gnrc_netif_t *netif);
 
+/**
+ * @brief   Reads a received frame from the interface's device into a new
+ *          packet snip
+ *
+ * Uses @ref netdev_driver_t::recv_loan to let the driver write the frame
+ * directly into the packet buffer if supported by the device, and the
+ * two-step @ref netdev_driver_t::recv otherwise. In both cases the frame is
+ * dropped if it is shorter than @p min_len or if the packet buffer is full.
+ *
+ * @param[in] netif     the network interface
+ * @param[in] min_len   minimum length of a valid frame
+ * @param[out] info     status information for the received frame, passed to
+ *                      the device driver
+ *
+ * @return  packet snip of type @ref GNRC_NETTYPE_UNDEF holding exactly the
+ *          received frame
+ * @return  NULL if no frame was received or the frame was dropped
+ *
+ * @internal
+ */
+gnrc_pktsnip_t *gnrc_netif_recv_pkt(gnrc_netif_t *netif, size_t min_len,
+                                    void *info);
+
 #if IS_USED(MODULE_GNRC_NETIF_IPV6) || DOXYGEN
 /**
  * @brief   Adds an IPv6 address to the interface
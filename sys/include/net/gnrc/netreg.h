@@ -10,6 +10,15 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default, the registry keeps one list of entries per
+ * @ref gnrc_nettype_t, which is searched linearly for the
+ * @ref gnrc_netreg_entry_t::demux_ctx "demux context" on every lookup. With
+ * many entries of the same type, e.g. dozens of UDP sockets, the
+ * `gnrc_netreg_hash` pseudo-module can be used instead. It keeps the entries
+ * in a hash table keyed by type and demux context, so a lookup only searches
+ * the entries that fall into the same bucket. The API does not change.
+ *
  * @{
  *
  * @file
@@ -72,6 +81,16 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @brief   Number of buckets of the hash table as exponent of 2^n
+ *
+ * @note    Only used with the `gnrc_netreg_hash` pseudo-module. Must be
+ *          between 1 and 16.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_SIZE_EXP
+#define CONFIG_GNRC_NETREG_HASH_SIZE_EXP    (4U)
+#endif
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -79,6 +98,17 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Initializer for gnrc_netreg_entry_t::nettype, if it exists
+ *
+ * @internal
+ */
+#if defined(MODULE_GNRC_NETREG_HASH)
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE     , GNRC_NETTYPE_UNDEF
+#else
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -96,9 +126,11 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -115,7 +147,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+                                                       { .mbox = _mbox } \
+                                                       _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -132,7 +165,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+                                                      { .cbd = _cbd } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 /** @} */
 
 /**
@@ -210,6 +244,16 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETREG_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Type of the protocol the entry is registered for
+     *
+     * @internal
+     *
+     * @note    Only available with the `gnrc_netreg_hash` pseudo-module.
+     */
+    gnrc_nettype_t nettype;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -35,6 +35,7 @@
 #include <string.h>
 
 #include "cpu_conf.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/neterr.h"
@@ -63,6 +64,55 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of slabs for packet snip descriptors
+ *
+ * @details Only used with the `gnrc_pktbuf_static_slab` module. With it,
+ *          allocations that fit into one of three size classes (packet snips,
+ *          small headers, large headers) are served in O(1) from per-class
+ *          free lists of fixed-size slabs, falling back to the first-fit
+ *          allocator otherwise. @ref gnrc_pktbuf_add() does not need to take
+ *          the packet buffer's mutex when both snip and data fit into slabs.
+ *
+ *          The slabs are taken from the static packet buffer, so they reduce
+ *          the space left for larger allocations accordingly.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_SNIP_NUMOF   (24U)
+#endif
+
+/**
+ * @brief   Size of small header slabs in bytes
+ *
+ * @details Fits e.g. UDP and 6LoWPAN fragmentation headers.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_SIZE   (16U)
+#endif
+
+/**
+ * @brief   Number of small header slabs
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_NUMOF  (16U)
+#endif
+
+/**
+ * @brief   Size of large header slabs in bytes
+ *
+ * @details Fits e.g. IPv6 headers and netif headers with two long addresses.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE     (48U)
+#endif
+
+/**
+ * @brief   Number of large header slabs
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_NUMOF    (8U)
+#endif
 /** @} */
 
 /**
@@ -94,6 +144,41 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds a new gnrc_pktsnip_t and its packet to the packet buffer, that
+ *          is expected to stay there for a long time
+ *
+ * Same as @ref gnrc_pktbuf_add(), e.g. for reassembly buffers that are kept
+ * while the fragments of a datagram trickle in. With the
+ * `gnrc_pktbuf_static_bestfit` module, such allocations are placed at the end
+ * of the packet buffer, away from the short-lived allocations at its start,
+ * so they do not break up the free space in between.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      Data of the new gnrc_pktsnip_t. If @p data is NULL no data
+ *                      will be inserted into `result`.
+ * @param[in] size      Length of @p data. If this value is 0 the
+ *                      gnrc_pktsnip::data field of the newly created snip will
+ *                      be NULL.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_BESTFIT) || defined(DOXYGEN)
+gnrc_pktsnip_t *gnrc_pktbuf_add_long_lived(gnrc_pktsnip_t *next, const void *data,
+                                           size_t size, gnrc_nettype_t type);
+#else
+static inline gnrc_pktsnip_t *gnrc_pktbuf_add_long_lived(gnrc_pktsnip_t *next,
+                                                         const void *data,
+                                                         size_t size,
+                                                         gnrc_nettype_t type)
+{
+    return gnrc_pktbuf_add(next, data, size, type);
+}
+#endif
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -285,7 +370,11 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes and, with
+ *          the `gnrc_pktbuf_static_slab` module, slab hits and misses.
+ *          For the static packet buffer, the largest free chunk and the
+ *          fragmentation ratio (share of free bytes outside the largest
+ *          free chunk) are reported as well.
  */
 void gnrc_pktbuf_stats(void);
 #endif
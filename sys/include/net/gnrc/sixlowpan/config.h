@@ -121,6 +121,33 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up reassembly buffer entries by
+ *          as exponent of 2^n
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_frag_rb_hash` module
+ *
+ * Entries are distributed over the buckets by their link-layer source and
+ * destination address and datagram tag. Choose this about as large as
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE_EXP
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE_EXP          (2U)
+#endif
+
+/**
+ * @brief   Number of flows the IPHC encoder caches compressed addresses for
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_iphc_cache` module
+ *
+ * A flow is identified by its IPv6 source and destination address, the
+ * interface, and the link-layer destination address. If there are more flows,
+ * the entries are replaced round-robin.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE                  (4U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -120,12 +120,20 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
  *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the generation of the context buffer
+ *
+ * The generation changes whenever a context is updated, added, or removed, so
+ * state derived from context lookups can be checked for staleness.
+ *
+ * @note    Lifetime expiry does not change the generation. Check the contexts
+ *          in question with @ref gnrc_sixlowpan_ctx_lookup_id() to catch that.
+ *
+ * @return  The current generation of the context buffer.
+ */
+unsigned gnrc_sixlowpan_ctx_generation(void);
 
 /**
  * @brief   Check if a prefix matches a compression context
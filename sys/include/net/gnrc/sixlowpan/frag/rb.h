@@ -10,6 +10,22 @@
  * @defgroup net_gnrc_sixlowpan_frag_rb 6LoWPAN reassembly buffer
  * @ingroup  net_gnrc_sixlowpan_frag
  * @brief    6LoWPAN reassembly buffer
+ *
+ * With fragment forwarding (`gnrc_sixlowpan_frag_minfwd` or
+ * `gnrc_sixlowpan_frag_sfr`), a new reassembly buffer entry only allocates
+ * space for the IPv6 header and grows to the full datagram once it is clear
+ * the datagram can not be forwarded. With the
+ * `gnrc_sixlowpan_frag_rb_cut_through` pseudo-module, an entry for fragments
+ * according to [RFC 4944] instead reserves the whole datagram right away, as
+ * their headers carry its final size. All fragments, including the
+ * decompressed first one, are copied directly into their final place. If the
+ * first fragment is forwarded, the reserved space is shrunk to that fragment
+ * or released. Entries for fragments according to [RFC 8931] are not
+ * affected, as the size in their headers does not account for header
+ * decompression.
+ *
+ * [RFC 4944]: https://tools.ietf.org/html/rfc4944
+ * [RFC 8931]: https://tools.ietf.org/html/rfc8931
  * @{
  *
  * @file
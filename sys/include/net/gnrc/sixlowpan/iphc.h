@@ -10,6 +10,14 @@
  * @defgroup    net_gnrc_sixlowpan_iphc   IPv6 header compression (IPHC)
  * @ingroup     net_gnrc_sixlowpan
  * @brief       IPv6 header compression for 6LoWPAN.
+ *
+ * With the `gnrc_sixlowpan_iphc_cache` module, the encoder caches the
+ * compressed addresses of the last
+ * @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE flows, so following packets of a
+ * flow skip the context lookups and address compression. Only the traffic
+ * class, flow label, next header, and hop limit are compressed per packet.
+ * A cache entry is discarded when the compression contexts or the link-layer
+ * address of the interface change.
  * @{
  *
  * @file
@@ -11,6 +11,16 @@
  * @ingroup     net_gnrc
  * @brief       RIOT's TCP implementation for the GNRC network stack.
  *
+ * Selective acknowledgments (RFC 2018) are supported with the pseudomodule
+ * `gnrc_tcp_sack`. They let the sender retransmit only the segments that were
+ * actually lost when multiple segments are in flight.
+ *
+ * Congestion control is provided by @ref sys_congure with the pseudomodule
+ * `gnrc_tcp_congure` and can be chosen per connection with
+ * gnrc_tcp_tcb_set_congure(), e.g. @ref sys_congure_reno,
+ * @ref sys_congure_vegas for short queues on multi-hop networks or
+ * @ref sys_congure_cubic.
+ *
  * @{
  *
  * @file
@@ -23,6 +33,7 @@
 #define NET_GNRC_TCP_H
 
 #include <stdint.h>
+#include "iolist.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -121,6 +132,43 @@ int gnrc_tcp_init(void);
  */
 void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
 
+#if defined(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief Set the congestion control of a connection.
+ *
+ * Without congestion control, the amount of unacknowledged data is only
+ * limited by the peers receive window and @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE.
+ * The CongURE object is initialized when the connection is established, its
+ * sizes are in bytes. Each connection needs its own CongURE object, e.g.
+ *
+ * @code{.c}
+ * static const congure_reno_snd_consts_t consts = {
+ *     .mss = CONFIG_GNRC_TCP_MSS,
+ *     .init_cwnd = 2 * CONFIG_GNRC_TCP_MSS,
+ *     .init_ssthresh = CONGURE_WND_SIZE_MAX,
+ *     .cwnd_lower = CONFIG_GNRC_TCP_MSS,
+ *     .cwnd_upper = CONGURE_WND_SIZE_MAX,
+ * };
+ * static congure_reno_snd_t reno;
+ *
+ * gnrc_tcp_tcb_init(&tcb);
+ * congure_reno_snd_setup(&reno, &consts);
+ * gnrc_tcp_tcb_set_congure(&tcb, &reno.super);
+ * @endcode
+ *
+ * @note Only available with module `gnrc_tcp_congure`.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre The connection of @p tcb must be closed.
+ *
+ * @param[in,out] tcb        TCB of the connection.
+ * @param[in]     congure    Congestion control to use, set up with a CongURE
+ *                           implementation. NULL to disable it.
+ */
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *congure);
+#endif
+
 /**
  * @brief Initialize Transmission Control Block (TCB) queue
  * @pre @p queue must not be NULL.
@@ -213,7 +261,7 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Blocks until @p len bytes were transmitted and acknowledged or an error occurred.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -234,6 +282,46 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Transmit data from a list of buffers to connected peer.
+ *
+ * Up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE segments are sent without waiting
+ * for their acknowledgment, as far as the peers receive window allows. The
+ * payload of each segment is copied from the buffers in @p iolist when it is
+ * (re)transmitted, so no packet buffer space is occupied while waiting for
+ * acknowledgments.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p iolist must not be NULL.
+ *
+ * @note Blocks until all data in @p iolist was transmitted and acknowledged or
+ *       an error occurred. @p iolist and the buffers it points to must not be
+ *       modified until then.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[in]     iolist                     List of buffers that should be transmitted.
+ * @param[in]     user_timeout_duration_ms   If not zero and not all data was acknowledged
+ *                                           the function returns after user_timeout_duration_ms.
+ *                                           If zero, no timeout will be triggered.
+ *                                           If GNRC_TCP_NO_TIMEOUT the timeout is disabled
+ *                                           causing the function to block until all data was
+ *                                           transmitted or and error occurred.
+ *
+ * @note If less than the size of @p iolist is returned, data beyond the
+ *       acknowledged bytes was dropped. It must be sent again, starting with
+ *       the first byte that was not acknowledged.
+ *
+ * @return   The number of successfully transmitted and acknowledged bytes.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired before any data
+ *           was acknowledged.
+ */
+ssize_t gnrc_tcp_send_iolist(gnrc_tcp_tcb_t *tcb, const iolist_t *iolist,
+                             const uint32_t user_timeout_duration_ms);
+
 /**
  * @brief Receive Data from the peer.
  *
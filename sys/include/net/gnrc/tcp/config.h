@@ -108,6 +108,24 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments per connection.
+ *
+ * The payload of these segments is not copied, but taken from the buffer
+ * passed to gnrc_tcp_send() when the segment is (re)transmitted.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of out-of-order segments a receiver holds back and reports
+ *        in SACK blocks, if module `gnrc_tcp_sack` is used.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SACK_OOO_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
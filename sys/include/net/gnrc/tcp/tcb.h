@@ -21,6 +21,7 @@
 #define NET_GNRC_TCP_TCB_H
 
 #include <stdint.h>
+#include "iolist.h"
 #include "ringbuffer.h"
 #include "mutex.h"
 #include "evtimer_msg.h"
@@ -34,10 +35,28 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include "congure.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Sent, but not yet acknowledged segment.
+ *
+ * The segment does not hold a copy of its payload. The payload is taken from
+ * the buffer of the ongoing send call, whenever the segment is (re)transmitted.
+ */
+typedef struct {
+    uint32_t seq;          /**< Sequence number of the segment */
+    uint32_t sent;         /**< Timestamp of the first transmission */
+    uint16_t len;          /**< Payload length */
+    uint16_t ctl;          /**< Control bits of the segment */
+    uint8_t flags;         /**< Scoreboard flags */
+} gnrc_tcp_seg_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -62,7 +81,6 @@ typedef struct sock_tcp {
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
@@ -70,7 +88,19 @@ typedef struct sock_tcp {
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_tcp_seg_t snd_queue[CONFIG_GNRC_TCP_SND_QUEUE_SIZE]; /**< Unacknowledged segments */
+    uint8_t snd_queue_len;   /**< Number of unacknowledged segments */
+    const iolist_t *snd_buf; /**< Data of the ongoing send call */
+    size_t snd_buf_len;      /**< Size of @p snd_buf in bytes */
+    uint32_t snd_buf_seq;    /**< Sequence number of the first byte in @p snd_buf */
+#ifdef MODULE_GNRC_TCP_SACK
+    gnrc_pktsnip_t *rcv_ooo[CONFIG_GNRC_TCP_SACK_OOO_QUEUE_SIZE]; /**< Out-of-order segments,
+                                                                       latest first */
+#endif
+#ifdef MODULE_GNRC_TCP_CONGURE
+    congure_snd_t *congure;  /**< Congestion control, NULL if not used */
+    uint32_t recover;        /**< snd_nxt when the last loss was reported */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
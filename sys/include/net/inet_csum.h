@@ -73,6 +73,55 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates a checksum field after a 16-bit word of its checksum domain
+ *          was changed, without recalculating the checksum over the whole
+ *          domain
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details In contrast to the other functions, @p csum is the normalized
+ *          checksum as found in the header, i.e. its 1's complement. Like
+ *          a freshly calculated checksum, the result may be 0x0000, which
+ *          e.g. UDP has to transmit as 0xffff.
+ *
+ * @param[in] csum      The current value of the checksum field.
+ * @param[in] old_val   The old value of the word in host byte order.
+ * @param[in] new_val   The new value of the word in host byte order.
+ *
+ * @return  The new value of the checksum field.
+ */
+static inline uint16_t inet_csum_update(uint16_t csum, uint16_t old_val,
+                                        uint16_t new_val)
+{
+    /* RFC 1624, equation 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum + (uint16_t)~old_val + (uint32_t)new_val;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum;
+}
+
+/**
+ * @brief   Updates a checksum field after a region of its checksum domain was
+ *          replaced, e.g. an address in a header was rewritten
+ *
+ * @see inet_csum_update()
+ *
+ * @pre     The region starts at an even offset of the checksum domain.
+ *
+ * @param[in] csum      The current value of the checksum field.
+ * @param[in] old_buf   The old content of the region.
+ * @param[in] new_buf   The new content of the region.
+ * @param[in] len       Length of the region in byte.
+ *
+ * @return  The new value of the checksum field.
+ */
+uint16_t inet_csum_replace(uint16_t csum, const uint8_t *old_buf,
+                           const uint8_t *new_buf, uint16_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -64,6 +64,13 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * Resources are searched in the order they are given, which needs to be
+ * alphabetical by their path. The `nanocoap_resource_bsearch` pseudo-module
+ * makes use of that to skip all resources that cannot match the URI-path of a
+ * request using a binary search, see @ref coap_find_resource(). This speeds up
+ * handling requests when there are many resources, at the cost of a few
+ * hundred bytes of ROM.
+ *
  * @{
  *
  * @file
@@ -1875,6 +1882,28 @@ extern ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, \
  */
 int coap_match_path(const coap_resource_t *resource, uint8_t *uri);
 
+/**
+ * @brief   Finds the first resource that may match a given URI
+ *
+ * None of the resources before the returned one matches @p uri with
+ * @ref coap_match_path(), not even as a subtree, so a linear search over
+ * @p resources can start at the returned one and get the same result.
+ *
+ * @note This function is not intended for application use.
+ * @internal
+ *
+ * @pre @p resources is in alphabetical order of coap_resource_t::path
+ *
+ * @param[in] resources         Array of CoAP resources to search
+ * @param[in] resources_numof   Number of resources in @p resources
+ * @param[in] uri               Null-terminated string URI to search for
+ *
+ * @return  Index of the first resource that matches @p uri or sorts after it
+ * @return  @p resources_numof if there is no such resource
+ */
+size_t coap_find_resource(const coap_resource_t *resources,
+                          size_t resources_numof, const char *uri);
+
 #if defined(MODULE_GCOAP) || defined(DOXYGEN)
 /**
  * @name    Functions -- gcoap specific
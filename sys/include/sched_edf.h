@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_edf Earliest Deadline First Scheduler
+ * @ingroup     sys
+ * @brief       Earliest-deadline-first (EDF) scheduling for periodic threads
+ *              within one priority level of the fixed-priority scheduler.
+ *
+ * Threads that register with this module get a period and a relative
+ * deadline. Each period a new job of the thread is released, and the job has
+ * to be completed (by calling @ref sched_edf_wait()) before its absolute
+ * deadline. All registered threads run at priority @ref SCHED_EDF_PRIO, and
+ * whenever the scheduler picks a thread of that priority, it runs the one
+ * with the earliest absolute deadline instead of the head of the runqueue.
+ *
+ * Threads of a higher priority preempt EDF threads as usual, and threads of
+ * a lower priority only run while no EDF job is pending. This allows to mix
+ * fixed-priority threads (e.g. the network stack) with a band of periodic
+ * tasks that can use up to 100% of the CPU time left to them without missing
+ * a deadline, where rate-monotonic priorities would only guarantee about 69%.
+ *
+ * Jobs that complete after their deadline are counted in
+ * @ref sched_edf_t::misses and, with `schedstatistics`, in
+ * @ref schedstat_t::deadline_misses of the thread. A job that is not
+ * completed until the next release just delays the following jobs, no job
+ * is dropped.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduler
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(SCHED_EDF_TIMERBASE) || defined(DOXYGEN)
+/**
+ * @brief   ztimer clock periods and deadlines are given in
+ */
+#define SCHED_EDF_TIMERBASE     ZTIMER_USEC
+#endif
+
+#if !defined(SCHED_EDF_PRIO) || defined(DOXYGEN)
+/**
+ * @brief   Priority the EDF threads are scheduled with
+ *
+ * @details Defaults to one level above the main thread
+ */
+#define SCHED_EDF_PRIO          (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+#if !defined(SCHED_EDF_NUMOF) || defined(DOXYGEN)
+/**
+ * @brief   Maximum number of threads registered at the same time
+ */
+#define SCHED_EDF_NUMOF         (4U)
+#endif
+
+/**
+ * @brief   Thread flag used to wake up a thread on the release of its next job
+ */
+#define THREAD_FLAG_SCHED_EDF   (1u << 13)
+
+/**
+ * @brief   Periodic EDF task
+ *
+ * All times are in ticks of @ref SCHED_EDF_TIMERBASE.
+ */
+typedef struct {
+    ztimer_t timer;             /**< timer for the next release */
+    thread_t *thread;           /**< the registered thread */
+    uint32_t period;            /**< time between two releases */
+    uint32_t deadline;          /**< deadline relative to the release */
+    uint32_t release;           /**< release time of the current job */
+    uint32_t abs_deadline;      /**< absolute deadline of the current job */
+    unsigned jobs;              /**< number of completed jobs */
+    unsigned misses;            /**< number of jobs completed too late */
+} sched_edf_t;
+
+/**
+ * @brief   Registers the calling thread as periodic EDF task
+ *
+ * Moves the calling thread to priority @ref SCHED_EDF_PRIO and releases its
+ * first job immediately.
+ *
+ * @param[out] edf      EDF task, must stay valid until it is unregistered
+ * @param[in] period    time between two releases, must not be 0
+ * @param[in] deadline  deadline relative to each release, must not be 0 and
+ *                      not exceed @p period
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if @ref SCHED_EDF_NUMOF threads are already registered
+ */
+int sched_edf_register(sched_edf_t *edf, uint32_t period, uint32_t deadline);
+
+/**
+ * @brief   Completes the current job and waits for the release of the next
+ *
+ * Returns immediately if the next job has already been released, i.e. the
+ * current job overran its period.
+ *
+ * @pre     @p edf was registered by the calling thread
+ *
+ * @param[in,out] edf   EDF task of the calling thread
+ */
+void sched_edf_wait(sched_edf_t *edf);
+
+/**
+ * @brief   Unregisters an EDF task
+ *
+ * The thread stays at priority @ref SCHED_EDF_PRIO and is scheduled in
+ * runqueue order, like any other thread without deadline.
+ *
+ * @param[in,out] edf   EDF task to unregister
+ */
+void sched_edf_unregister(sched_edf_t *edf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_profiler Scheduler profiler
+ * @ingroup     sys
+ * @brief       Per-thread scheduling latency and time slice profiler
+ *
+ * In addition to what @ref schedstatistics.h records, this module tracks for
+ * every thread
+ *
+ * - how often it got scheduled and how often it was descheduled while still
+ *   being ready to run (preempted or yielded),
+ * - the longest time it ran without being descheduled,
+ * - a histogram of the time between becoming ready and running, and
+ * - a histogram of that time for wakeups from interrupt context, i.e. the
+ *   time between an ISR unblocking the thread and the thread running.
+ *
+ * The histograms are log-linear: Every power of two is divided into
+ * 2^@ref CONFIG_SCHED_PROFILER_HIST_SUB_BITS equally sized buckets, so the
+ * relative error of a bucket is bounded while a small number of buckets
+ * covers latencies from microseconds to milliseconds. Latencies beyond the
+ * last bucket are counted in the last bucket, counters saturate.
+ *
+ * The profile can be printed with the `schedprof` shell command or, with the
+ * `sched_profiler_cbor` module, exported as CBOR to be collected from
+ * devices in the field.
+ *
+ * @note    The profiles need about
+ *          4 * @ref CONFIG_SCHED_PROFILER_HIST_NUMOF + 24 bytes of RAM per
+ *          thread slot (`MAXTHREADS`).
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef SCHED_PROFILER_H
+#define SCHED_PROFILER_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_sched_profiler_conf Scheduler profiler compile configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of buckets per power of two as exponent of two
+ */
+#ifndef CONFIG_SCHED_PROFILER_HIST_SUB_BITS
+#define CONFIG_SCHED_PROFILER_HIST_SUB_BITS     1
+#endif
+
+/**
+ * @brief   Number of buckets of a latency histogram
+ *
+ * @details With the default of 2 buckets per power of two, 24 buckets
+ *          resolve latencies up to 4ms.
+ */
+#ifndef CONFIG_SCHED_PROFILER_HIST_NUMOF
+#define CONFIG_SCHED_PROFILER_HIST_NUMOF        24
+#endif
+/** @} */
+
+/**
+ * @brief   Log-linear latency histogram in microseconds
+ */
+typedef struct {
+    uint16_t buckets[CONFIG_SCHED_PROFILER_HIST_NUMOF]; /**< counters */
+} sched_profiler_hist_t;
+
+/**
+ * @brief   Profile of a thread
+ */
+typedef struct {
+    uint32_t laststart;             /**< time stamp the thread was scheduled */
+    uint32_t ready_since;           /**< time stamp the thread became ready */
+    uint32_t max_slice_us;          /**< longest time run without interruption */
+    uint32_t switches;              /**< how often the thread was scheduled */
+    uint32_t preemptions;           /**< how often the thread was descheduled
+                                         while being ready */
+    uint8_t ready;                  /**< readiness state, internal */
+    sched_profiler_hist_t latency;  /**< ready-to-running latencies */
+    sched_profiler_hist_t irq_latency; /**< latencies of wakeups from ISRs */
+} sched_profiler_t;
+
+/**
+ * @brief   Profiles, indexed by PID
+ */
+extern sched_profiler_t sched_profiler[KERNEL_PID_LAST + 1];
+
+/**
+ * @brief   Registers the profiler with the scheduler
+ *
+ * Called by auto_init.
+ */
+void sched_profiler_init(void);
+
+/**
+ * @brief   Resets all profiles
+ */
+void sched_profiler_reset(void);
+
+/**
+ * @brief   Gets the lower bound of a histogram bucket
+ *
+ * @param[in] idx   index of the bucket
+ *
+ * @return  smallest latency in microseconds counted in bucket @p idx
+ */
+uint32_t sched_profiler_bucket_min(unsigned idx);
+
+/**
+ * @brief   Prints the profiles of all threads that were scheduled
+ */
+void sched_profiler_print(void);
+
+#if IS_USED(MODULE_SCHED_PROFILER_CBOR) || defined(DOXYGEN)
+/**
+ * @brief   Exports the profiles of all threads that were scheduled as CBOR
+ *
+ * The profile is encoded as array of
+ * `CONFIG_SCHED_PROFILER_HIST_SUB_BITS` followed by one array per thread:
+ * `[pid, switches, preemptions, max_slice_us, [latency buckets...],
+ * [irq latency buckets...]]`.
+ *
+ * @param[out] buf  buffer to encode to, may be NULL to get the needed size
+ * @param[in] len   size of @p buf
+ *
+ * @return  length of the encoded profile
+ * @return  -ENOBUFS if @p buf is too small
+ */
+ssize_t sched_profiler_to_cbor(uint8_t *buf, size_t len);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_PROFILER_H */
+/** @} */
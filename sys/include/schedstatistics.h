@@ -31,6 +31,8 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -43,6 +45,11 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+    unsigned int deadline_misses; /**< How many jobs of this thread completed
+                                       after their deadline, see
+                                       @ref sys_sched_edf */
+#endif
 } schedstat_t;
 
 /**
@@ -50,6 +57,14 @@ typedef struct {
  */
 extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+/**
+ *  @brief  Sched statistics callback, see @ref sched_callback_t
+ *
+ *  Exposed for modules that register a scheduler callback of their own to
+ *  chain it.
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 /**
  *  @brief  Registers the sched statistics callback and sets laststart for
  *          caller thread
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_spscrb Single-producer/single-consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffer for one producer and one consumer
+ *
+ * In contrast to @ref sys_tsrb, this ringbuffer does not disable interrupts.
+ * The write index is only ever modified by the producer and the read index
+ * only by the consumer, so with atomic loads and stores of the indices one
+ * interrupt service routine (or thread) can fill the buffer while a thread
+ * empties it. Bulk transfers are copied with `memcpy()`, and both sides can
+ * access the buffer memory directly to avoid copying at all, e.g. for DMA:
+ *
+ * - the producer gets the largest contiguous free region with
+ *   @ref spscrb_reserve() and makes the bytes written into it available
+ *   with @ref spscrb_commit()
+ * - the consumer gets the largest contiguous filled region with
+ *   @ref spscrb_peek_contig() and releases the bytes read from it with
+ *   @ref spscrb_consume()
+ *
+ * Functions are marked as either producer or consumer functions, each must
+ * only be called by the respective side. Functions that only get the fill
+ * level can be called by either.
+ *
+ * @attention   Buffer size must be a power of two and at most 32 KiB!
+ *
+ * @{
+ *
+ * @file
+ * @brief       Single-producer/single-consumer ringbuffer interface
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef SPSCRB_H
+#define SPSCRB_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Single-producer/single-consumer ringbuffer struct
+ */
+typedef struct {
+    uint8_t *buf;               /**< Buffer to operate on */
+    uint16_t size;              /**< Size of buffer, must be power of 2 */
+    uint16_t writes;            /**< total number of writes, producer only */
+    uint16_t reads;             /**< total number of reads, consumer only */
+    uint16_t discard;           /**< write index at the last discard,
+                                     producer only */
+    uint8_t discards;           /**< number of discards, producer only */
+    uint8_t discards_seen;      /**< number of discards applied, consumer
+                                     only */
+} spscrb_t;
+
+/**
+ * @brief   Static initializer
+ */
+#define SPSCRB_INIT(BUF) { (BUF), sizeof(BUF), 0, 0, 0, 0, 0 }
+
+/**
+ * @brief       Initialize a spscrb
+ *
+ * @param[out]  rb        Datum to initialize
+ * @param[in]   buffer    Buffer to use by spscrb
+ * @param[in]   bufsize   `sizeof (buffer)`, must be power of 2 and at most
+ *                        32768
+ */
+static inline void spscrb_init(spscrb_t *rb, uint8_t *buffer, unsigned bufsize)
+{
+    assert((bufsize != 0) && (bufsize <= 0x8000) &&
+           ((bufsize & (bufsize - 1)) == 0));
+
+    rb->buf = buffer;
+    rb->size = bufsize;
+    rb->writes = 0;
+    rb->reads = 0;
+    rb->discard = 0;
+    rb->discards = 0;
+    rb->discards_seen = 0;
+}
+
+/**
+ * @brief       Get number of bytes available for reading
+ *
+ * May be less than the actual number for the producer, if the consumer did
+ * not yet apply a @ref spscrb_discard().
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      nr of available bytes
+ */
+static inline unsigned spscrb_avail(const spscrb_t *rb)
+{
+    uint16_t reads = atomic_load_u16(&rb->reads);
+
+    if (atomic_load_u8(&rb->discards) != rb->discards_seen) {
+        reads = atomic_load_u16(&rb->discard);
+    }
+    return (uint16_t)(atomic_load_u16(&rb->writes) - reads);
+}
+
+/**
+ * @brief       Test if the spscrb is empty
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      0   if not empty
+ * @return      1   otherwise
+ */
+static inline int spscrb_empty(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == 0;
+}
+
+/**
+ * @brief       Get free space in ringbuffer
+ *
+ * Space freed by @ref spscrb_discard() is only reclaimed when the consumer
+ * accesses the buffer the next time.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      nr of free bytes
+ */
+static inline unsigned spscrb_free(const spscrb_t *rb)
+{
+    return rb->size - (uint16_t)(atomic_load_u16(&rb->writes) -
+                                 atomic_load_u16(&rb->reads));
+}
+
+/**
+ * @brief       Test if the spscrb is full
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      0   if not full
+ * @return      1   otherwise
+ */
+static inline int spscrb_full(const spscrb_t *rb)
+{
+    return spscrb_free(rb) == 0;
+}
+
+/**
+ * @brief       Add a byte to ringbuffer (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   c   Character to add to ringbuffer
+ *
+ * @return      0   on success
+ * @return      -1  if no space available
+ */
+int spscrb_add_one(spscrb_t *rb, uint8_t c);
+
+/**
+ * @brief       Add bytes to ringbuffer (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ *
+ * @return      nr of bytes read from @p src
+ */
+size_t spscrb_add(spscrb_t *rb, const uint8_t *src, size_t n);
+
+/**
+ * @brief       Get the largest contiguous free region (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  len size of the region, 0 if the buffer is full
+ *
+ * @return      start of the region
+ */
+uint8_t *spscrb_reserve(spscrb_t *rb, size_t *len);
+
+/**
+ * @brief       Make bytes written to a reserved region available (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes written, at most the length returned by
+ *                  the preceding @ref spscrb_reserve()
+ */
+static inline void spscrb_commit(spscrb_t *rb, size_t n)
+{
+    atomic_store_u16(&rb->writes, rb->writes + n);
+}
+
+/**
+ * @brief       Discard all data currently in the ringbuffer (producer)
+ *
+ * Bytes the consumer is reading while this is called might still be
+ * returned to it.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ */
+static inline void spscrb_discard(spscrb_t *rb)
+{
+    atomic_store_u16(&rb->discard, rb->writes);
+    atomic_store_u8(&rb->discards, rb->discards + 1);
+}
+
+/**
+ * @brief       Get a byte from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      >=0 byte that has been read
+ * @return      -1  if no byte available
+ */
+int spscrb_get_one(spscrb_t *rb);
+
+/**
+ * @brief       Get a byte from ringbuffer, without removing it (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      >=0 byte that has been read
+ * @return      -1  if no byte available
+ */
+int spscrb_peek_one(spscrb_t *rb);
+
+/**
+ * @brief       Get bytes from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ *
+ * @return      nr of bytes written to @p dst
+ */
+size_t spscrb_get(spscrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Get bytes from ringbuffer, without removing them (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ *
+ * @return      nr of bytes written to @p dst
+ */
+size_t spscrb_peek(spscrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Get the largest contiguous filled region (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  len size of the region, 0 if the buffer is empty
+ *
+ * @return      start of the region
+ */
+const uint8_t *spscrb_peek_contig(spscrb_t *rb, size_t *len);
+
+/**
+ * @brief       Remove bytes from ringbuffer (consumer)
+ *
+ * Also used to release bytes read from a region returned by
+ * @ref spscrb_peek_contig().
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   max number of bytes to remove
+ *
+ * @return      nr of bytes removed
+ */
+size_t spscrb_consume(spscrb_t *rb, size_t n);
+
+/**
+ * @brief       Remove all bytes from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ */
+static inline void spscrb_clear(spscrb_t *rb)
+{
+    spscrb_consume(rb, rb->size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSCRB_H */
+/** @} */
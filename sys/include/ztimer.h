@@ -262,6 +262,7 @@
 #ifndef ZTIMER_H
 #define ZTIMER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "sched.h"
@@ -299,6 +300,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child when in a heap */
+    ztimer_base_t *prev;        /**< left sibling or parent when in a heap */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -366,6 +371,10 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    bool heap;                      /**< timers are kept in a pairing heap,
+                                         see @ref sys_ztimer_heap           */
+#endif
 };
 
 /**
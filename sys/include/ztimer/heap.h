@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_heap  ztimer pairing heap timer queue
+ * @ingroup     sys_ztimer
+ * @brief       O(log n) timer queue for ztimer clocks with many timers
+ *
+ * By default, each ztimer clock keeps its timers in a delta-encoded singly
+ * linked list. Setting and removing a timer thus costs O(n) with interrupts
+ * disabled, which becomes noticeable on clocks with hundreds of pending
+ * timers.
+ *
+ * With the `ztimer_heap` module, a clock can be switched to a pairing heap
+ * instead. Insertion is O(1), removal of arbitrary timers and expiry of the
+ * first timer are O(log n) amortized. The ztimer API does not change.
+ *
+ * The heap is selected per clock using @ref ztimer_heap_enable(), e.g.
+ * right after @ref ztimer_init() for the clocks that are known to carry many
+ * timers:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * ztimer_heap_enable(ZTIMER_MSEC);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    Enabling the module grows each @ref ztimer_t by two pointers,
+ *          also for clocks that keep using the list.
+ *
+ * @note    Unlike the list, timers expiring at the very same tick are not
+ *          guaranteed to fire in the order they were set.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer pairing heap API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ZTIMER_HEAP_H
+#define ZTIMER_HEAP_H
+
+#include <stdbool.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Make @p clock keep its timers in a pairing heap
+ *
+ * Timers already set on @p clock are migrated to the heap. Calling this on a
+ * clock already using the heap has no effect.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ */
+void ztimer_heap_enable(ztimer_clock_t *clock);
+
+/**
+ * @brief   Check if @p entry is in the heap of @p clock
+ *
+ * @internal
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   entry       timer entry to check
+ */
+static inline bool _ztimer_heap_is_set(const ztimer_clock_t *clock,
+                                       const ztimer_base_t *entry)
+{
+    return entry->prev || (entry == clock->list.next);
+}
+
+/**
+ * @brief   Add @p entry to the heap of @p clock
+ *
+ * @internal
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   entry       timer entry, offset relative to the clock's base
+ */
+void _ztimer_heap_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Remove @p entry from the heap of @p clock
+ *
+ * @internal
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   entry       timer entry to remove
+ *
+ * @return  true if @p entry was removed
+ */
+bool _ztimer_heap_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Remove and return the first timer of the heap of @p clock
+ *
+ * @internal
+ *
+ * @param[in]   clock       ztimer clock to operate on, heap must not be empty
+ *
+ * @return  the removed timer entry
+ */
+ztimer_base_t *_ztimer_heap_pop(ztimer_clock_t *clock);
+
+/**
+ * @brief   Move the base of the heap of @p clock to @p now
+ *
+ * All timers that expired between the old base and @p now are clamped to
+ * @p now so they are due immediately.
+ *
+ * @internal
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   now         new base time
+ */
+void _ztimer_heap_advance(ztimer_clock_t *clock, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_HEAP_H */
+/** @} */
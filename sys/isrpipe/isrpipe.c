@@ -22,12 +22,12 @@
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize)
 {
     mutex_init(&isrpipe->mutex);
-    tsrb_init(&isrpipe->tsrb, buf, bufsize);
+    spscrb_init(&isrpipe->rb, buf, bufsize);
 }
 
 int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
 {
-    int res = tsrb_add_one(&isrpipe->tsrb, c);
+    int res = spscrb_add_one(&isrpipe->rb, c);
 
     /* `res` is either 0 on success or -1 when the buffer is full. Either way,
      * unlocking the mutex is fine.
@@ -39,7 +39,7 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
 
 int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n)
 {
-    int res = tsrb_add(&isrpipe->tsrb, buf, n);
+    int res = spscrb_add(&isrpipe->rb, buf, n);
 
     mutex_unlock(&isrpipe->mutex);
 
@@ -50,7 +50,7 @@ int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
 {
     int res;
 
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    while (!(res = spscrb_get(&isrpipe->rb, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
     }
     return res;
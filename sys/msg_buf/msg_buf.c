@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_msg_buf
+ * @{
+ *
+ * @file
+ * @brief       Messages with buffer ownership implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "memarray.h"
+#include "msg.h"
+#include "msg_buf.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static msg_buf_pool_t *_pools;
+
+void msg_buf_pool_init(msg_buf_pool_t *pool, void *mem, size_t size,
+                       size_t num)
+{
+    size_t buf_size = MSG_BUF_SIZE(size);
+    unsigned state;
+
+    pool->data = mem;
+    pool->num = num;
+    for (size_t i = 0; i < num; i++) {
+        msg_buf_t *buf = (msg_buf_t *)(void *)&pool->data[i * buf_size];
+
+        buf->pool = pool;
+        buf->owner = KERNEL_PID_UNDEF;
+    }
+    memarray_init(&pool->mem, mem, buf_size, num);
+    state = irq_disable();
+    pool->next = _pools;
+    _pools = pool;
+    irq_restore(state);
+}
+
+msg_buf_t *msg_buf_alloc(msg_buf_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    msg_buf_t *buf = memarray_alloc(&pool->mem);
+
+    if (buf != NULL) {
+        buf->owner = thread_getpid();
+    }
+    irq_restore(state);
+    return buf;
+}
+
+static void _free(msg_buf_t *buf)
+{
+    buf->owner = KERNEL_PID_UNDEF;
+    memarray_free(&buf->pool->mem, buf);
+}
+
+void msg_buf_free(msg_buf_t *buf)
+{
+    unsigned state = irq_disable();
+
+    assert(buf->owner == thread_getpid());
+    _free(buf);
+    irq_restore(state);
+}
+
+int msg_send_buf(msg_t *m, msg_buf_t *buf, kernel_pid_t target_pid)
+{
+    kernel_pid_t me = thread_getpid();
+    int res;
+
+    assert(!irq_is_in() && (buf->owner == me));
+    m->content.ptr = buf;
+    /* hand over before sending, the receiver might run (and free the buffer)
+     * before msg_send() returns */
+    buf->owner = target_pid;
+    res = msg_send(m, target_pid);
+    if (res != 1) {
+        DEBUG("msg_buf: could not send %p to %" PRIkernel_pid "\n",
+              (void *)buf, target_pid);
+        buf->owner = me;
+    }
+    return res;
+}
+
+void msg_buf_release_owned(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+
+    for (msg_buf_pool_t *pool = _pools; pool != NULL; pool = pool->next) {
+        for (size_t i = 0; i < pool->num; i++) {
+            msg_buf_t *buf = (msg_buf_t *)(void *)
+                             &pool->data[i * pool->mem.size];
+
+            if (buf->owner == pid) {
+                DEBUG("msg_buf: releasing %p of %" PRIkernel_pid "\n",
+                      (void *)buf, pid);
+                _free(buf);
+            }
+        }
+    }
+    irq_restore(state);
+}
@@ -42,6 +42,11 @@
 
 #include "net/gcoap/forward_proxy.h"
 
+#if IS_USED(MODULE_GCOAP_CONGURE)
+#include "clist.h"
+#include "congure/cocoa.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -82,6 +87,12 @@ static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu);
 
+#if IS_USED(MODULE_GCOAP_CONGURE)
+static gcoap_congure_remote_t *_congure_get(const sock_udp_ep_t *remote);
+static void _congure_done(gcoap_request_memo_t *memo, bool acked);
+static void _congure_discard(gcoap_request_memo_t *memo);
+#endif
+
 #if IS_USED(MODULE_GCOAP_DTLS)
 static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *arg);
 static void _dtls_free_up_session(void *arg);
@@ -119,12 +130,24 @@ typedef struct {
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#if IS_USED(MODULE_GCOAP_CONGURE)
+    gcoap_congure_remote_t congure_remotes[CONFIG_GCOAP_CONGURE_REMOTES_MAX];
+                                        /* Congestion control per remote
+                                           endpoint */
+#endif
 } gcoap_state_t;
 
 static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
 };
 
+#if IS_USED(MODULE_GCOAP_CONGURE)
+static const congure_cocoa_snd_consts_t _congure_consts = {
+    .nstart = CONFIG_GCOAP_CONGURE_NSTART,
+    .init_rto = CONFIG_COAP_ACK_TIMEOUT_MS,
+};
+#endif
+
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
 static event_queue_t _queue;
@@ -370,6 +393,11 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote,
                 _find_req_memo(&memo, &pdu, remote, true);
                 if ((memo != NULL) && (memo->send_limit != GCOAP_SEND_LIMIT_NON)) {
                     DEBUG("gcoap: empty ACK processed, stopping retransmissions\n");
+#if IS_USED(MODULE_GCOAP_CONGURE)
+                    /* the exchange is acknowledged, even though the response
+                     * is still to come */
+                    _congure_done(memo, true);
+#endif
                     _cease_retransmission(memo);
                 } else {
                     DEBUG("gcoap: empty ACK matches no known CON, ignoring\n");
@@ -421,6 +449,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote,
                 if (memo->resp_evt_tmout.queue) {
                     event_timeout_clear(&memo->resp_evt_tmout);
                 }
+#if IS_USED(MODULE_GCOAP_CONGURE)
+                _congure_done(memo, true);
+#endif
                 memo->state = truncated ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 if (memo->resp_handler) {
                     memo->resp_handler(memo, &pdu, remote);
@@ -473,6 +504,13 @@ static void _on_resp_timeout(void *arg) {
     /* reduce retries remaining, double timeout and resend */
     else {
         memo->send_limit--;
+#if IS_USED(MODULE_GCOAP_CONGURE)
+#ifndef CONFIG_GCOAP_NO_RETRANS_BACKOFF
+        /* variable backoff factor of CoCoA */
+        memo->timeout = congure_cocoa_snd_backoff(memo->rto, memo->timeout);
+#endif
+        uint32_t timeout  = memo->timeout;
+#else
 #ifdef CONFIG_GCOAP_NO_RETRANS_BACKOFF
         unsigned i        = 0;
 #else
@@ -482,6 +520,7 @@ static void _on_resp_timeout(void *arg) {
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
         uint32_t end = (uint32_t)TIMEOUT_RANGE_END << i;
         timeout = random_uint32_range(timeout, end);
+#endif
 #endif
         event_timeout_set(&memo->resp_evt_tmout, timeout);
 
@@ -672,7 +711,13 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     coap_method_flags_t method_flag = coap_method2flag(
         coap_get_code_detail(pdu));
 
-    for (size_t i = 0; i < listener->resources_len; i++) {
+    size_t i = 0;
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_BSEARCH)) {
+        i = coap_find_resource(listener->resources, listener->resources_len,
+                               (char *)uri);
+    }
+
+    for (; i < listener->resources_len; i++) {
         *resource = &listener->resources[i];
 
         int res = coap_match_path(*resource, uri);
@@ -817,6 +862,9 @@ static void _expire_request(gcoap_request_memo_t *memo)
 {
     DEBUG("coap: received timeout message\n");
     if ((memo->state == GCOAP_MEMO_RETRANSMIT) || (memo->state == GCOAP_MEMO_WAIT)) {
+#if IS_USED(MODULE_GCOAP_CONGURE)
+        _congure_done(memo, false);
+#endif
         memo->state = GCOAP_MEMO_TIMEOUT;
         /* Pass response to handler */
         if (memo->resp_handler) {
@@ -840,6 +888,108 @@ static void _expire_request(gcoap_request_memo_t *memo)
     }
 }
 
+#if IS_USED(MODULE_GCOAP_CONGURE)
+/*
+ * Finds the congestion control state for a remote endpoint, or replaces the
+ * least recently used state without outstanding requests with a new one.
+ *
+ * Must be called with _coap_state.lock held.
+ *
+ * return NULL if no more requests must be sent to the endpoint
+ */
+static gcoap_congure_remote_t *_congure_get(const sock_udp_ep_t *remote)
+{
+    gcoap_congure_remote_t *victim = NULL;
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_CONGURE_REMOTES_MAX; i++) {
+        gcoap_congure_remote_t *entry = &_coap_state.congure_remotes[i];
+
+        if ((entry->remote.port != 0) &&
+            sock_udp_ep_equal(&entry->remote, remote)) {
+            if (entry->congure.in_flight >= entry->congure.super.cwnd) {
+                return NULL;
+            }
+            entry->last_used = now;
+            return entry;
+        }
+        if (entry->congure.in_flight > 0) {
+            continue;
+        }
+        /* prefer unused entries over the least recently used one */
+        if (!victim || ((victim->remote.port != 0) &&
+                        ((entry->remote.port == 0) ||
+                         (now - entry->last_used > now - victim->last_used)))) {
+            victim = entry;
+        }
+    }
+    if (victim) {
+        DEBUG("gcoap: new congestion control state for remote\n");
+        memcpy(&victim->remote, remote, sizeof(sock_udp_ep_t));
+        congure_cocoa_snd_setup(&victim->congure, &_congure_consts);
+        victim->congure.super.driver->init(&victim->congure.super, NULL);
+        victim->last_used = now;
+    }
+    return victim;
+}
+
+/*
+ * Reports the end of the exchange of a memo to the congestion control, by a
+ * response or empty ACK if acked, by a timeout otherwise.
+ */
+static void _congure_done(gcoap_request_memo_t *memo, bool acked)
+{
+    mutex_lock(&_coap_state.lock);
+    if (memo->congure == NULL) {
+        mutex_unlock(&_coap_state.lock);
+        return;
+    }
+
+    congure_snd_t *c = &memo->congure->congure.super;
+    congure_snd_msg_t msg = {
+        .send_time = memo->send_time,
+        .size = 1,
+    };
+
+    if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
+        /* no RTT samples from non-confirmable requests */
+        c->driver->report_msg_discarded(c, msg.size);
+    }
+    else if (acked) {
+        congure_snd_ack_t ack = {
+            .recv_time = ztimer_now(ZTIMER_MSEC),
+            .size = 1,
+            .clean = 1,
+        };
+
+        msg.resends = CONFIG_COAP_MAX_RETRANSMIT - memo->send_limit;
+        c->driver->report_msg_acked(c, &msg, &ack);
+    }
+    else {
+        clist_node_t msgs = { .next = NULL };
+
+        msg.resends = CONFIG_COAP_MAX_RETRANSMIT - memo->send_limit;
+        clist_rpush(&msgs, &msg.super);
+        c->driver->report_msgs_timeout(c, (congure_snd_msg_t *)msgs.next);
+    }
+    memo->congure = NULL;
+    mutex_unlock(&_coap_state.lock);
+}
+
+/* Reports a request that was not sent to the congestion control */
+static void _congure_discard(gcoap_request_memo_t *memo)
+{
+    mutex_lock(&_coap_state.lock);
+    if (memo->congure != NULL) {
+        congure_snd_t *c = &memo->congure->congure.super;
+
+        c->driver->report_msg_discarded(c, 1);
+        memo->congure = NULL;
+    }
+    mutex_unlock(&_coap_state.lock);
+}
+#endif
+
 /*
  * Handler for /.well-known/core. Lists registered handlers, except for
  * /.well-known/core itself.
@@ -1200,6 +1350,15 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
             DEBUG("gcoap: dropping request; no space for response tracking\n");
             return 0;
         }
+#if IS_USED(MODULE_GCOAP_CONGURE)
+        memo->congure = _congure_get(remote);
+        if (!memo->congure) {
+            memo->state = GCOAP_MEMO_UNUSED;
+            mutex_unlock(&_coap_state.lock);
+            DEBUG("gcoap: dropping request; too many requests to remote\n");
+            return 0;
+        }
+#endif
 
         memo->resp_handler = resp_handler;
         memo->context = context;
@@ -1221,9 +1380,20 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
             }
             if (memo->msg.data.pdu_buf) {
                 memo->send_limit  = CONFIG_COAP_MAX_RETRANSMIT;
+#if IS_USED(MODULE_GCOAP_CONGURE)
+                memo->rto = congure_cocoa_snd_rto(&memo->congure->congure,
+                                                  ztimer_now(ZTIMER_MSEC));
+                timeout = memo->rto;
+#if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
+                timeout = random_uint32_range(timeout,
+                            timeout * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000 + 1);
+#endif
+                memo->timeout = timeout;
+#else
                 timeout           = (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS;
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
                 timeout = random_uint32_range(timeout, TIMEOUT_RANGE_END);
+#endif
 #endif
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
@@ -1243,6 +1413,14 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+#if IS_USED(MODULE_GCOAP_CONGURE)
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            congure_snd_t *c = &memo->congure->congure.super;
+
+            memo->send_time = ztimer_now(ZTIMER_MSEC);
+            c->driver->report_msg_sent(c, 1);
+        }
+#endif
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -1272,6 +1450,9 @@ ssize_t gcoap_req_send_tl(const uint8_t *buf, size_t len,
     }
     if (res <= 0) {
         if (memo != NULL) {
+#if IS_USED(MODULE_GCOAP_CONGURE)
+            _congure_discard(memo);
+#endif
             if (msg_type == COAP_TYPE_CON) {
                 *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
             }
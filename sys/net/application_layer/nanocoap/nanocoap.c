@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "kernel_defines.h"
 #include "net/nanocoap.h"
 
 #define ENABLE_DEBUG 0
@@ -181,6 +182,79 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
     return res;
 }
 
+/* compares path to the first len characters of uri, like strcmp() */
+static int _cmp_path_prefix(const char *path, const char *uri, size_t len)
+{
+    int res = strncmp(path, uri, len);
+
+    if (res == 0) {
+        /* path is longer than the prefix of uri it starts with */
+        res = (path[len] != '\0');
+    }
+    return res;
+}
+
+/* first index before hi whose path compares to the first len characters of
+ * uri with a result of at least min */
+static size_t _find_path(const coap_resource_t *resources, size_t hi,
+                         const char *uri, size_t len, int min)
+{
+    size_t lo = 0;
+
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+
+        if (_cmp_path_prefix(resources[mid].path, uri, len) >= min) {
+            hi = mid;
+        }
+        else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+size_t coap_find_resource(const coap_resource_t *resources,
+                          size_t resources_numof, const char *uri)
+{
+    size_t len = strlen(uri);
+    size_t first = _find_path(resources, resources_numof, uri, len, 0);
+    size_t hi = first;
+
+    /* Subtree resources that are a prefix of uri sort before it, and so does
+     * everything in between, which hence starts with that prefix as well. So
+     * only prefixes of the path right before the current bound are left. */
+    while (hi > 0) {
+        const char *path = resources[hi - 1].path;
+        size_t match = 0;
+
+        while ((path[match] != '\0') && (path[match] == uri[match])) {
+            match++;
+        }
+        if (path[match] != '\0') {
+            /* only paths up to the common part may still be a prefix */
+            hi = _find_path(resources, hi - 1, uri, match, 1);
+            continue;
+        }
+
+        /* path is a prefix of uri, and so are all equal paths before it */
+        size_t equal = _find_path(resources, hi - 1, uri, match, 0);
+
+        for (size_t i = equal; i < hi; i++) {
+            if (resources[i].methods & COAP_MATCH_SUBTREE) {
+                first = i;
+                break;
+            }
+        }
+        if (match == 0) {
+            break;
+        }
+        hi = _find_path(resources, equal, uri, match - 1, 1);
+    }
+
+    return first;
+}
+
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
     const coap_optpos_t *optpos = pkt->options;
@@ -437,7 +511,12 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
-    for (unsigned i = 0; i < resources_numof; i++) {
+    unsigned i = 0;
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_BSEARCH)) {
+        i = coap_find_resource(resources, resources_numof, (char *)uri);
+    }
+
+    for (; i < resources_numof; i++) {
         const coap_resource_t *resource = &resources[i];
         if (!(resource->methods & method_flag)) {
             continue;
@@ -13,13 +13,74 @@
  */
 
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
+#include "byteorder.h"
 #include "od.h"
+#include "unaligned.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* buffers are accessed as words, tell the compiler they alias bytes */
+typedef uint32_t __attribute__((may_alias)) _word_t;
+typedef uint16_t __attribute__((may_alias)) _half_t;
+
+static uint16_t _fold(uint64_t sum)
+{
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+/* Sums up @p len (even) bytes as 16-bit words in network byte order. As the
+ * one's complement sum does not depend on the byte order (RFC 1071, 2.(B)),
+ * whole words are summed up in host byte order and the result is swapped. */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+    if ((uintptr_t)buf & 1) {
+        for (; len >= 4; buf += 4, len -= 4) {
+            sum += unaligned_get_u32(buf);
+        }
+        if (len) {
+            sum += unaligned_get_u16(buf);
+        }
+    }
+    else {
+        const _word_t *word;
+
+        if (((uintptr_t)buf & 2) && len) {
+            sum += *(const _half_t *)buf;
+            buf += 2;
+            len -= 2;
+        }
+        word = (const _word_t *)buf;
+        for (; len >= 16; word += 4, len -= 16) {
+            sum += word[0];
+            sum += word[1];
+            sum += word[2];
+            sum += word[3];
+        }
+        for (; len >= 4; word++, len -= 4) {
+            sum += *word;
+        }
+        if (len) {
+            sum += *(const _half_t *)word;
+        }
+    }
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return byteorder_swaps(_fold(sum));
+#else
+    return _fold(sum);
+#endif
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -45,22 +106,28 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _sum(buf, len & ~1U);   /* add all complete 16-bit words */
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+        csum += (uint16_t)(buf[len - 1] << 8);  /* add last byte as top half of 16-byte word */
 
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
 }
 
+uint16_t inet_csum_replace(uint16_t csum, const uint8_t *old_buf,
+                           const uint8_t *new_buf, uint16_t len)
+{
+    /* RFC 1624, equation 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum;
+
+    sum += (uint16_t)~inet_csum(0, old_buf, len);
+    sum += inet_csum(0, new_buf, len);
+
+    return ~_fold(sum);
+}
+
 /** @} */
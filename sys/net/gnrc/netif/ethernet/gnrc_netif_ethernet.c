@@ -21,6 +21,7 @@
 #include "net/ethernet/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/netdev/eth.h"
 #ifdef MODULE_GNRC_IPV6
 #include "net/ipv6/hdr.h"
@@ -169,42 +170,12 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
-    netdev_t *dev = netif->dev;
-    gnrc_pktsnip_t *pkt = NULL;
+    gnrc_pktsnip_t *pkt;
     netdev_eth_rx_info_t rx_info = { .flags = 0 };
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
-
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
-
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
-
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
 
-            goto out;
-        }
-
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
-            DEBUG("gnrc_netif_ethernet: read error.\n");
-            goto safe_out;
-        }
-#ifdef MODULE_NETSTATS_L2
-        netif->stats.rx_count++;
-        netif->stats.rx_bytes += nread;
-#endif
-
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
-
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
+    pkt = gnrc_netif_recv_pkt(netif, sizeof(ethernet_hdr_t), &rx_info);
+    if (pkt) {
+        int nread = pkt->size;
 
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
               gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
@@ -222,7 +193,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
 
 #ifdef MODULE_L2FILTER
-        if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
+        if (!l2filter_pass(netif->dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
             DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
             goto safe_out;
         }
@@ -255,7 +226,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
-out:
     return pkt;
 
 safe_out:
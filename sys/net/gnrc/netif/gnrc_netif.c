@@ -1603,7 +1603,80 @@ int gnrc_netif_default_init(gnrc_netif_t *netif)
     return 0;
 }
 
-static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
+typedef struct {
+    gnrc_pktsnip_t *pkt;
+    size_t min_len;
+} _recv_loan_ctx_t;
+
+static void *_recv_loan_alloc(void *arg, size_t len)
+{
+    _recv_loan_ctx_t *ctx = arg;
+
+    if (len < ctx->min_len) {
+        DEBUG("gnrc_netif: received frame is too short\n");
+        return NULL;
+    }
+    ctx->pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (ctx->pkt == NULL) {
+        DEBUG("gnrc_netif: cannot allocate pktsnip.\n");
+        return NULL;
+    }
+    return ctx->pkt->data;
+}
+
+gnrc_pktsnip_t *gnrc_netif_recv_pkt(gnrc_netif_t *netif, size_t min_len,
+                                    void *info)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_pktsnip_t *pkt;
+    int bytes_expected;
+    int nread;
+
+    if (dev->driver->recv_loan) {
+        _recv_loan_ctx_t ctx = { .pkt = NULL, .min_len = min_len };
+
+        nread = dev->driver->recv_loan(dev, _recv_loan_alloc, &ctx, info);
+        pkt = ctx.pkt;
+        bytes_expected = pkt ? (int)pkt->size : 0;
+    }
+    else {
+        bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+        if (bytes_expected <= 0) {
+            return NULL;
+        }
+        if ((size_t)bytes_expected < min_len) {
+            DEBUG("gnrc_netif: received frame is too short\n");
+            dev->driver->recv(dev, NULL, bytes_expected, NULL);
+            return NULL;
+        }
+        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+        if (pkt == NULL) {
+            DEBUG("gnrc_netif: cannot allocate pktsnip.\n");
+            /* drop the frame on the device */
+            dev->driver->recv(dev, NULL, bytes_expected, NULL);
+            return NULL;
+        }
+        nread = dev->driver->recv(dev, pkt->data, bytes_expected, info);
+    }
+
+    if (nread <= 0) {
+        DEBUG("gnrc_netif: read error.\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    if (nread < bytes_expected) {
+        /* we've got less than the expected frame size,
+         * so free the unused space */
+        gnrc_pktbuf_realloc_data(pkt, nread);
+    }
+#ifdef MODULE_NETSTATS_L2
+    netif->stats.rx_count++;
+    netif->stats.rx_bytes += nread;
+#endif
+    return pkt;
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 
 #if IS_USED(MODULE_GNRC_NETIF_EVENTS)
 /**
@@ -1719,14 +1792,52 @@ static void _send_queued_pkt(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     gnrc_pktsnip_t *pkt;
 
-    if ((pkt = gnrc_netif_pktq_get(netif)) != NULL) {
-        _send(netif, pkt, true);
-        gnrc_netif_pktq_sched_get(netif);
+    while ((pkt = gnrc_netif_pktq_get(netif)) != NULL) {
+        int res = _send(netif, pkt, true);
+
+        /* with gnrc_netif_batch, drain the queue until the device is busy */
+        if (!IS_USED(MODULE_GNRC_NETIF_BATCH) || (res == -EBUSY)) {
+            gnrc_netif_pktq_sched_get(netif);
+            break;
+        }
     }
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
 
-static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
+#if IS_USED(MODULE_GNRC_NETIF_BATCH)
+int gnrc_netif_send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts)
+{
+    return _gnrc_netapi_send_recv(netif->pid, pkts, GNRC_NETIF_BATCH_MSG);
+}
+
+/* cuts the first packet off a batch, returns the rest */
+static gnrc_pktsnip_t *_batch_split(gnrc_pktsnip_t *pkt)
+{
+    while (pkt->next != NULL) {
+        gnrc_pktsnip_t *next = pkt->next;
+
+        if (next->type == GNRC_NETTYPE_NETIF) {
+            pkt->next = NULL;
+            return next;
+        }
+        pkt = next;
+    }
+    return NULL;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_BATCH) */
+
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+static void _wait_after_send(uint32_t *last_wakeup)
+{
+    ztimer_periodic_wakeup(ZTIMER_USEC, last_wakeup,
+                           CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    /* override last_wakeup in case last_wakeup +
+     * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
+    *last_wakeup = ztimer_now(ZTIMER_USEC);
+}
+#endif
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
     (void)push_back; /* only used with IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     int res;
@@ -1740,7 +1851,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
         if (put_res == 0) {
             DEBUG("gnrc_netif: (re-)queued pkt %p\n", (void *)pkt);
             _send_queued_pkt(netif);
-            return;
+            return 0;
         }
         else {
             LOG_WARNING("gnrc_netif: can't queue packet for sending\n");
@@ -1809,7 +1920,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
         }
         if (put_res == 0) {
             DEBUG("gnrc_netif: (re-)queued pkt %p\n", (void *)pkt);
-            return; /* early return to not release */
+            return res; /* early return to not release */
         }
         else {
             LOG_ERROR("gnrc_netif: can't queue packet for sending\n");
@@ -1817,13 +1928,14 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
              * was full. The packet should be dropped here anyway */
             gnrc_pktbuf_release_error(pkt, ENOMEM);
         }
-        return;
+        return res;
     }
     else {
         /* remove previously held packet */
         gnrc_pktbuf_release(pkt);
     }
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+    return res;
 }
 
 static void *_gnrc_netif_thread(void *args)
@@ -1893,16 +2005,26 @@ static void *_gnrc_netif_thread(void *args)
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(netif, msg.content.ptr, false);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-                ztimer_periodic_wakeup(
-                        ZTIMER_USEC,
-                        &last_wakeup,
-                        CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
-                    );
-                /* override last_wakeup in case last_wakeup +
-                 * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
-                last_wakeup = ztimer_now(ZTIMER_USEC);
+                _wait_after_send(&last_wakeup);
 #endif
                 break;
+#if IS_USED(MODULE_GNRC_NETIF_BATCH)
+            case GNRC_NETIF_BATCH_MSG: {
+                gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+                DEBUG("gnrc_netif: GNRC_NETIF_BATCH_MSG received\n");
+                while (pkt != NULL) {
+                    gnrc_pktsnip_t *next = _batch_split(pkt);
+
+                    _send(netif, pkt, false);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+                    _wait_after_send(&last_wakeup);
+#endif
+                    pkt = next;
+                }
+                break;
+            }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_BATCH) */
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
@@ -30,13 +30,37 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+#define _NETREG_NUMOF       (1U << CONFIG_GNRC_NETREG_HASH_SIZE_EXP)
+
+/* The registry as hash table by gnrc_nettype_t and demux context */
+static gnrc_netreg_entry_t *netreg[_NETREG_NUMOF];
+
+static inline unsigned _bucket(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* multiplicative (Fibonacci) hashing, the upper bits are best mixed */
+    uint32_t key = demux_ctx ^ ((uint32_t)type << 24);
+
+    return (uint32_t)(key * 2654435769UL) >>
+           (32U - CONFIG_GNRC_NETREG_HASH_SIZE_EXP);
+}
+#else
+#define _NETREG_NUMOF       (GNRC_NETTYPE_NUMOF)
+
 /* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+static gnrc_netreg_entry_t *netreg[_NETREG_NUMOF];
+
+static inline unsigned _bucket(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return type;
+}
+#endif
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, _NETREG_NUMOF * sizeof(gnrc_netreg_entry_t *));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -61,7 +85,10 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    entry->nettype = type;
+#endif
+    LL_PREPEND(netreg[_bucket(type, entry->demux_ctx)], entry);
 
     return 0;
 }
@@ -72,7 +99,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(netreg[_bucket(type, entry->demux_ctx)], entry);
 }
 
 /**
@@ -94,8 +121,26 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+        /* entries of other types may share the bucket */
+        gnrc_netreg_entry_t *head;
+
+        if (from) {
+            type = from->nettype;
+            head = from->next;
+        }
+        else {
+            head = netreg[_bucket(type, demux_ctx)];
+        }
+        for (res = head; res != NULL; res = res->next) {
+            if ((res->demux_ctx == demux_ctx) && (res->nettype == type)) {
+                break;
+            }
+        }
+#else
         gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
+#endif
     }
 
     return res;
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "_nib-ft-trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE)
+
+/**
+ * @brief   Node of the prefix trie
+ *
+ * A node either holds entries with its prefix or, as a branch node, has
+ * two children that diverge at bit _nib_ft_trie_node_t::pfx_len.
+ */
+typedef struct _nib_ft_trie_node {
+    struct _nib_ft_trie_node *child[2]; /**< children by bit after prefix */
+    _nib_offl_entry_t *entries;         /**< entries with the prefix, in
+                                         *   off-link table order */
+    ipv6_addr_t pfx;                    /**< prefix of the node */
+    uint8_t pfx_len;                    /**< length of the prefix in bits */
+    bool used;                          /**< node is in use */
+} _nib_ft_trie_node_t;
+
+static _nib_ft_trie_node_t _trie_nodes[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _nib_ft_trie_node_t *_root;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+/* checks if a and b are equal in the bits from `from` up to excluding `to` */
+static bool _bits_equal(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                        unsigned from, unsigned to)
+{
+    for (unsigned i = from / 8; (i * 8) < to; i++) {
+        uint8_t diff = a->u8[i] ^ b->u8[i];
+
+        if (i == (from / 8)) {
+            diff &= 0xff >> (from % 8);
+        }
+        if (((i + 1) * 8) > to) {
+            diff &= 0xff << (((i + 1) * 8) - to);
+        }
+        if (diff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static _nib_ft_trie_node_t *_node_alloc(const ipv6_addr_t *pfx,
+                                        unsigned pfx_len)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_trie_nodes); i++) {
+        _nib_ft_trie_node_t *node = &_trie_nodes[i];
+
+        if (!node->used) {
+            memset(node, 0, sizeof(*node));
+            ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+            node->pfx_len = pfx_len;
+            node->used = true;
+            return node;
+        }
+    }
+    /* every entry needs at most one node of its own and one branch node */
+    assert(false);
+    return NULL;
+}
+
+/* removes the node at link if it has neither entries nor two children */
+static void _node_collapse(_nib_ft_trie_node_t **link)
+{
+    _nib_ft_trie_node_t *node = *link;
+
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    node->used = false;
+}
+
+void _nib_ft_trie_init(void)
+{
+    _root = NULL;
+    memset(_trie_nodes, 0, sizeof(_trie_nodes));
+}
+
+void _nib_ft_trie_add(_nib_offl_entry_t *entry)
+{
+    _nib_ft_trie_node_t **link = &_root;
+    _nib_ft_trie_node_t *node;
+    const ipv6_addr_t *pfx = &entry->pfx;
+    unsigned pfx_len = entry->pfx_len;
+
+    assert((pfx_len > 0) && (pfx_len <= IPV6_ADDR_BIT_LEN));
+    while ((node = *link) != NULL) {
+        unsigned match = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+        match = (match > node->pfx_len) ? node->pfx_len : match;
+        match = (match > pfx_len) ? pfx_len : match;
+        if (match < node->pfx_len) {
+            /* pfx diverges from or is shorter than the prefix of node, so
+             * put a node for pfx above node */
+            _nib_ft_trie_node_t *leaf = _node_alloc(pfx, pfx_len);
+
+            if (match == pfx_len) {
+                leaf->child[_bit(&node->pfx, pfx_len)] = node;
+                *link = leaf;
+            }
+            else {
+                _nib_ft_trie_node_t *branch = _node_alloc(pfx, match);
+
+                branch->child[_bit(&node->pfx, match)] = node;
+                branch->child[_bit(pfx, match)] = leaf;
+                *link = branch;
+            }
+            node = leaf;
+            break;
+        }
+        if (node->pfx_len == pfx_len) {
+            break;
+        }
+        link = &node->child[_bit(pfx, node->pfx_len)];
+    }
+    if (node == NULL) {
+        node = _node_alloc(pfx, pfx_len);
+        *link = node;
+    }
+
+    /* keep entries in table order, so ties resolve as in a linear search */
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    while ((*ptr != NULL) && (*ptr < entry)) {
+        ptr = &(*ptr)->trie_next;
+    }
+    entry->trie_next = *ptr;
+    *ptr = entry;
+    DEBUG("nib: added %p to prefix trie node %p (/%u)\n", (void *)entry,
+          (void *)node, pfx_len);
+}
+
+void _nib_ft_trie_del(_nib_offl_entry_t *entry)
+{
+    _nib_ft_trie_node_t **parent = NULL;
+    _nib_ft_trie_node_t **link = &_root;
+    _nib_ft_trie_node_t *node;
+    _nib_offl_entry_t **ptr;
+
+    while (((node = *link) != NULL) && (node->pfx_len < entry->pfx_len)) {
+        parent = link;
+        link = &node->child[_bit(&entry->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != entry->pfx_len)) {
+        return;
+    }
+    for (ptr = &node->entries; *ptr != NULL; ptr = &(*ptr)->trie_next) {
+        if (*ptr == entry) {
+            break;
+        }
+    }
+    if (*ptr == NULL) {
+        return;
+    }
+    *ptr = entry->trie_next;
+    entry->trie_next = NULL;
+    DEBUG("nib: removed %p from prefix trie node %p (/%u)\n", (void *)entry,
+          (void *)node, node->pfx_len);
+    if (node->entries == NULL) {
+        /* removing a leaf may leave its parent with only one child */
+        _node_collapse(link);
+        if (parent != NULL) {
+            _node_collapse(parent);
+        }
+    }
+}
+
+_nib_offl_entry_t *_nib_ft_trie_lookup(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _nib_ft_trie_node_t *node = _root;
+    unsigned checked = 0;
+
+    /* the bits up to the prefix of the parent were already compared */
+    while ((node != NULL) &&
+           _bits_equal(&node->pfx, dst, checked, node->pfx_len)) {
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->trie_next) {
+            if (entry->mode != _EMPTY) {
+                res = entry;
+                break;
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        checked = node->pfx_len;
+        node = node->child[_bit(dst, checked)];
+    }
+    return res;
+}
+#else  /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
+
+/** @} */
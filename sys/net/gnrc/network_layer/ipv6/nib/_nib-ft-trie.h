@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Prefix trie over the off-link entries of the NIB
+ *
+ * A path-compressed binary trie indexes the off-link entries by their prefix,
+ * so the longest prefix matching a destination is found in a number of steps
+ * bound by the prefix length instead of the number of entries.
+ *
+ * Entries are added to the trie when they get their prefix assigned in
+ * @ref _nib_offl_alloc() and removed when they are cleared in
+ * @ref _nib_offl_clear(). The trie needs at most two nodes per entry, so it
+ * never runs out of nodes.
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef PRIV_NIB_FT_TRIE_H
+#define PRIV_NIB_FT_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Empties the trie
+ */
+void _nib_ft_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * @pre `(entry != NULL) && (entry->pfx_len > 0)`
+ * @pre @p entry is not in the trie yet.
+ *
+ * @param[in] entry An off-link entry with its prefix set.
+ */
+void _nib_ft_trie_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @param[in] entry An off-link entry previously added using
+ *                  @ref _nib_ft_trie_add(). Nothing happens if it is not
+ *                  in the trie.
+ */
+void _nib_ft_trie_del(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Entries with mode @ref _EMPTY are skipped. If multiple entries with the
+ * longest prefix exist, the one coming first in the off-link table is
+ * returned.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no prefix matches @p dst.
+ */
+_nib_offl_entry_t *_nib_ft_trie_lookup(const ipv6_addr_t *dst);
+#else   /* MODULE_GNRC_IPV6_NIB_FT_TRIE || defined(DOXYGEN) */
+#define _nib_ft_trie_init()         (void)0
+#define _nib_ft_trie_add(entry)     (void)entry
+#define _nib_ft_trie_del(entry)     (void)entry
+#endif  /* MODULE_GNRC_IPV6_NIB_FT_TRIE || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_FT_TRIE_H */
+/** @} */
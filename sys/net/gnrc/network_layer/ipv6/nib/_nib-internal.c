@@ -27,7 +27,9 @@
 #include "net/gnrc/netif/internal.h"
 #include "random.h"
 
+#include "_nib-ft-trie.h"
 #include "_nib-internal.h"
+#include "_nib-nc-hash.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -38,6 +40,10 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+/* use counter for least recently used cache-out */
+static uint32_t _nodes_used;
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
@@ -60,8 +66,10 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+    _nib_nc_hash_init();
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    _nib_ft_trie_init();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -87,6 +95,25 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+static inline void _touch(_nib_onl_entry_t *node)
+{
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+    node->last_use = ++_nodes_used;
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASH */
+    (void)node;
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
+}
+
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+        _nib_nc_hash_del(node);
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +121,19 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        for (_nib_onl_entry_t *tmp = _nib_nc_hash_bucket(addr); tmp != NULL;
+             tmp = tmp->hash_next) {
+            if ((_nib_onl_get_if(tmp) == iface) &&
+                ipv6_addr_equal(addr, &tmp->ipv6)) {
+                DEBUG("  %p is an exact match\n", (void *)tmp);
+                _override_node(addr, iface, tmp);
+                return tmp;
+            }
+        }
+    }
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -124,6 +164,48 @@ static inline bool _is_gc(_nib_onl_entry_t *node)
             GNRC_IPV6_NIB_NC_INFO_AR_STATE_GC);
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
+                                                     unsigned iface,
+                                                     uint16_t cstate)
+{
+    clist_node_t *last = _next_removable.next, *ptr = last;
+    _nib_onl_entry_t *res = NULL;
+
+    DEBUG("nib: Searching for replaceable entries (addr = %s, iface = %u)\n",
+          ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+    if (last == NULL) {
+        return NULL;
+    }
+    /* take the least recently used garbage-collectible entry */
+    do {
+        _nib_onl_entry_t *tmp = (_nib_onl_entry_t *)(ptr = ptr->next);
+
+        if (_is_gc(tmp) &&
+            ((res == NULL) ||
+             ((_nodes_used - tmp->last_use) > (_nodes_used - res->last_use)))) {
+            res = tmp;
+        }
+    } while (ptr != last);
+    if (res == NULL) {
+        return NULL;
+    }
+    DEBUG("nib: Removing neighbor cache entry (addr = %s, iface = %u) ",
+          ipv6_addr_to_str(addr_str, &res->ipv6, sizeof(addr_str)),
+          _nib_onl_get_if(res));
+    DEBUG("for (addr = %s, iface = %u)\n",
+          ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+    /* call _nib_nc_remove to remove timers from _evtimer */
+    _nib_nc_remove(res);
+    _override_node(addr, iface, res);
+    /* cstate masked in _nib_nc_add() already */
+    res->info |= cstate;
+    res->mode = _NC;
+    _touch(res);
+    clist_rpush(&_next_removable, (clist_node_t *)res);
+    return res;
+}
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASH */
 static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                                                      unsigned iface,
                                                      uint16_t cstate)
@@ -170,6 +252,7 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
     }
     return res;
 }
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
 
 _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
                               uint16_t cstate)
@@ -191,6 +274,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         node->info |= cstate;
         node->mode |= _NC;
     }
+    _touch(node);
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
               ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
@@ -214,20 +298,41 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+    /* entries with the unspecified address are not in the index */
+    if (!ipv6_addr_is_unspecified(addr)) {
+        for (_nib_onl_entry_t *node = _nib_nc_hash_bucket(addr); node != NULL;
+             node = node->hash_next) {
+            if (_onl_matches(node, addr, iface)) {
+                DEBUG("  Found %p\n", (void *)node);
+                _touch(node);
+                return node;
+            }
+        }
+        DEBUG("  No suitable entry found\n");
+        return NULL;
+    }
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
@@ -493,7 +598,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+                _nib_nc_hash_del(tmp_node);
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _nib_nc_hash_add(tmp_node);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +621,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_ft_trie_add(dst);
     }
     return dst;
 }
@@ -550,6 +658,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_ft_trie_del(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -575,11 +684,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE)
+    return _nib_ft_trie_lookup(dst);
+#else   /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
-    DEBUG("nib: get match for destination %s from NIB\n",
-          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -600,6 +712,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -858,7 +971,9 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
+        _nib_nc_hash_del(node);
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _nib_nc_hash_add(node);
     }
     _nib_onl_set_if(node, iface);
 }
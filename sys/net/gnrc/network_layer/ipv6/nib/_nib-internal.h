@@ -93,6 +93,20 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry in the same bucket of the address hash index
+     *
+     * @note    Only available with module `gnrc_ipv6_nib_nc_hash`.
+     */
+    struct _nib_onl_entry *hash_next;
+    /**
+     * @brief   Value of the use counter at the last lookup of the entry
+     *
+     * @note    Only available with module `gnrc_ipv6_nib_nc_hash`.
+     */
+    uint32_t last_use;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -196,7 +210,15 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
+#if IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry with the same prefix in the prefix trie
+     *
+     * @note    Only available with module `gnrc_ipv6_nib_ft_trie`.
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -319,14 +341,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
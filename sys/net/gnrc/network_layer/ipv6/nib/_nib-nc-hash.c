@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "_nib-nc-hash.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+
+static _nib_onl_entry_t *_buckets[CONFIG_GNRC_IPV6_NIB_NUMOF];
+
+static inline unsigned _idx(const ipv6_addr_t *addr)
+{
+    /* neighbors mostly differ in the interface identifier, but cover the
+     * prefix as well for global addresses */
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^ addr->u32[2].u32 ^
+                    addr->u32[3].u32;
+
+    /* mix all bits into the lower ones, which select the bucket */
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bU;
+    hash ^= hash >> 16;
+    return hash % CONFIG_GNRC_IPV6_NIB_NUMOF;
+}
+
+void _nib_nc_hash_init(void)
+{
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+void _nib_nc_hash_add(_nib_onl_entry_t *node)
+{
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    _nib_onl_entry_t **bucket = &_buckets[_idx(&node->ipv6)];
+
+    DEBUG("nib: adding %p to hash bucket %u\n", (void *)node,
+          (unsigned)(bucket - _buckets));
+    node->hash_next = *bucket;
+    *bucket = node;
+}
+
+void _nib_nc_hash_del(_nib_onl_entry_t *node)
+{
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (_nib_onl_entry_t **link = &_buckets[_idx(&node->ipv6)]; *link;
+         link = &(*link)->hash_next) {
+        if (*link == node) {
+            *link = node->hash_next;
+            node->hash_next = NULL;
+            return;
+        }
+    }
+}
+
+_nib_onl_entry_t *_nib_nc_hash_bucket(const ipv6_addr_t *addr)
+{
+    return _buckets[_idx(addr)];
+}
+
+#else  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_IPV6_NIB_NC_HASH */
+
+/** @} */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Address hash index over the on-link entries of the NIB
+ *
+ * The on-link entries are chained into buckets by a hash of their IPv6
+ * address, so finding the entry for a neighbor only takes a look at the
+ * entries sharing its bucket instead of all entries. The interface is not
+ * part of the hash, so lookups for any interface work the same way.
+ *
+ * There are @ref CONFIG_GNRC_IPV6_NIB_NUMOF buckets. Entries with the
+ * unspecified address are not indexed.
+ *
+ * Entries are (re-)indexed whenever their address is set and removed from
+ * the index when they are cleared in @ref _nib_onl_clear().
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef PRIV_NIB_NC_HASH_H
+#define PRIV_NIB_NC_HASH_H
+
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Empties the index
+ */
+void _nib_nc_hash_init(void);
+
+/**
+ * @brief   Adds an on-link entry to the index
+ *
+ * @pre @p node is not in the index.
+ *
+ * @param[in] node  An on-link entry with its address set. Nothing happens if
+ *                  the address is unspecified.
+ */
+void _nib_nc_hash_add(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Removes an on-link entry from the index
+ *
+ * @pre The address of @p node did not change since it was added.
+ *
+ * @param[in] node  An on-link entry previously added using
+ *                  @ref _nib_nc_hash_add(). Nothing happens if it is not
+ *                  in the index.
+ */
+void _nib_nc_hash_del(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Gets the first entry of the bucket for @p addr
+ *
+ * The other entries of the bucket follow via
+ * _nib_onl_entry_t::hash_next. Entries in the bucket may have any address and
+ * mode, so the caller has to compare them.
+ *
+ * @param[in] addr  A specified IPv6 address.
+ *
+ * @return  The first entry of the bucket, NULL if the bucket is empty.
+ */
+_nib_onl_entry_t *_nib_nc_hash_bucket(const ipv6_addr_t *addr);
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN) */
+#define _nib_nc_hash_init()         (void)0
+#define _nib_nc_hash_add(node)      (void)node
+#define _nib_nc_hash_del(node)      (void)node
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_NC_HASH_H */
+/** @} */
@@ -38,6 +38,7 @@
 #endif
 
 #include "_nib-internal.h"
+#include "_nib-ft-trie.h"
 #include "_nib-arsm.h"
 #include "_nib-router.h"
 #include "_nib-6ln.h"
@@ -171,19 +172,24 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
 
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
-    _nib_offl_entry_t *entry = NULL;
     _nib_offl_entry_t *match = NULL;
 
     if (ipv6_addr_is_link_local(dst)) {
         return true;
     }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE)
+    match = _nib_ft_trie_lookup(dst);
+#else   /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
+    _nib_offl_entry_t *entry = NULL;
+
     while ((entry = _nib_offl_iter(entry))) {
         if ((ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
             ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
             match = entry;
         }
     }
+#endif  /* MODULE_GNRC_IPV6_NIB_FT_TRIE */
 
     if (match) {
         *iface = _nib_onl_get_if(match->next_hop);
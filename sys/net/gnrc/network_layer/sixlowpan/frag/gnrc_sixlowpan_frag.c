@@ -131,9 +131,10 @@ static uint16_t _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
     return offset;
 }
 
-static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
-                                   gnrc_sixlowpan_frag_fb_t *fbuf,
-                                   size_t payload_len)
+static gnrc_pktsnip_t *_build_1st_fragment(gnrc_netif_t *iface,
+                                           gnrc_sixlowpan_frag_fb_t *fbuf,
+                                           size_t payload_len,
+                                           uint16_t *res)
 {
     gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
     sixlowpan_frag_t *hdr;
@@ -154,7 +155,7 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
                            max_frag_size + sizeof(sixlowpan_frag_t));
 
     if (frag == NULL) {
-        return 0;
+        return NULL;
     }
 
     hdr = frag->next->data;
@@ -171,14 +172,15 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, local_offset);
-    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
-    return local_offset;
+    *res = local_offset;
+    return frag;
 }
 
-static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
-                                   gnrc_sixlowpan_frag_fb_t *fbuf,
-                                   size_t payload_len,
-                                   gnrc_pktsnip_t **tx_sync)
+static gnrc_pktsnip_t *_build_nth_fragment(gnrc_netif_t *iface,
+                                           gnrc_sixlowpan_frag_fb_t *fbuf,
+                                           size_t payload_len,
+                                           gnrc_pktsnip_t **tx_sync,
+                                           uint16_t *res)
 {
     gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
     sixlowpan_frag_n_t *hdr;
@@ -196,7 +198,7 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
                            max_frag_size + sizeof(sixlowpan_frag_n_t));
 
     if (frag == NULL) {
-        return 0;
+        return NULL;
     }
 
     hdr = frag->next->data;
@@ -237,9 +239,94 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
           "fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, hdr->offset,
           hdr->offset << 3, local_offset);
+    *res = local_offset;
+    return frag;
+}
+
+static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
+                                   gnrc_sixlowpan_frag_fb_t *fbuf,
+                                   size_t payload_len)
+{
+    uint16_t res;
+    gnrc_pktsnip_t *frag = _build_1st_fragment(iface, fbuf, payload_len, &res);
+
+    if (frag == NULL) {
+        return 0;
+    }
+    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    return res;
+}
+
+static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
+                                   gnrc_sixlowpan_frag_fb_t *fbuf,
+                                   size_t payload_len,
+                                   gnrc_pktsnip_t **tx_sync)
+{
+    uint16_t res;
+    gnrc_pktsnip_t *frag = _build_nth_fragment(iface, fbuf, payload_len,
+                                               tx_sync, &res);
+
+    if (frag == NULL) {
+        return 0;
+    }
     gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
-    return local_offset;
+    return res;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_BATCH)
+/**
+ * @brief   Builds all remaining fragments of @p fbuf and hands them to
+ *          @p iface in one batch
+ *
+ * @return  1, if the datagram was sent completely
+ * @return  0, if the packet buffer ran out before. All fragments built up
+ *          to that point were sent, fbuf::offset points to the first fragment
+ *          still to send.
+ * @return  -1, if not even one fragment could be built
+ */
+static int _send_fragments_batched(gnrc_netif_t *iface,
+                                    gnrc_sixlowpan_frag_fb_t *fbuf,
+                                    size_t payload_len,
+                                    gnrc_pktsnip_t **tx_sync)
+{
+    gnrc_pktsnip_t *batch = NULL, *last = NULL;
+
+    while (fbuf->offset < payload_len) {
+        gnrc_pktsnip_t *frag;
+        uint16_t res;
+
+        if (fbuf->offset == 0) {
+            frag = _build_1st_fragment(iface, fbuf, payload_len, &res);
+        }
+        else {
+            frag = _build_nth_fragment(iface, fbuf, payload_len, tx_sync,
+                                       &res);
+        }
+        if (frag == NULL) {
+            DEBUG("6lo frag: packet buffer full, sending %s fragments "
+                  "one by one\n", (batch) ? "remaining" : "all");
+            break;
+        }
+        fbuf->offset += res;
+        if (last == NULL) {
+            batch = frag;
+        }
+        else {
+            last->next = frag;
+        }
+        for (last = frag; last->next != NULL; last = last->next) {}
+    }
+    if (batch == NULL) {
+        return -1;
+    }
+    if (gnrc_netif_send_batch(iface, batch) < 1) {
+        DEBUG("6lo frag: unable to send batch over interface %u\n",
+              iface->pid);
+        gnrc_pktbuf_release(batch);
+    }
+    return (fbuf->offset >= payload_len) ? 1 : 0;
 }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_BATCH) */
 
 void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
@@ -271,6 +358,26 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         tx_sync = gnrc_tx_sync_split((pkt) ? pkt : fbuf->pkt);
     }
 
+#if IS_USED(MODULE_GNRC_NETIF_BATCH)
+    if (fbuf->offset < payload_len) {
+        if (_send_fragments_batched(iface, fbuf, payload_len, &tx_sync) != 0) {
+            /* datagram sent completely or not at all, remove original
+             * packet */
+            goto error;
+        }
+        if (IS_USED(MODULE_GNRC_TX_SYNC) && tx_sync) {
+            gnrc_pkt_append((pkt) ? pkt : fbuf->pkt, tx_sync);
+            tx_sync = NULL;
+        }
+        if (!gnrc_sixlowpan_frag_fb_send(fbuf)) {
+            DEBUG("6lo frag: message queue full, can't issue next fragment "
+                  "sending\n");
+            goto error;
+        }
+        thread_yield();
+        return;
+    }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_BATCH) */
     /* Check whether to send the first or an Nth fragment */
     if (fbuf->offset == 0) {
         if ((res = _send_1st_fragment(iface, fbuf, payload_len)) == 0) {
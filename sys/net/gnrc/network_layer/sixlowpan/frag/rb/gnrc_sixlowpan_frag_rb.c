@@ -68,6 +68,24 @@ static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 static xtimer_t _gc_timer;
 static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+#define RBUF_HASH_NUMOF (1U << CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE_EXP)
+
+/* An entry is linked into the bucket of its (src, dst, tag) when it is
+ * created and only unlinked when its slot is reused, so removed entries
+ * (`pkt == NULL`) may still be found in a bucket and need to be skipped */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_buckets[RBUF_HASH_NUMOF];
+static gnrc_sixlowpan_frag_rb_t *_rbuf_bucket_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* bucket + 1 the slot is linked into, 0 if it is not linked */
+static uint16_t _rbuf_bucket_of[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* lower bound for the arrival time of all entries in use, so garbage
+ * collection only needs to go through the buffer if anything may time out */
+static uint32_t _rbuf_oldest_arrival;
+static bool _rbuf_oldest_valid;
+/* slot to start the search for a free interval from */
+static unsigned _rbuf_int_next;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
@@ -79,11 +97,12 @@ static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size);
-/* gets an entry identified by its tuple */
+/* gets an entry identified by its tuple, with `reserve` the whole datagram is
+ * allocated when the entry is created */
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
-                     unsigned page);
+                     unsigned page, bool reserve);
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -180,6 +199,112 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
+static bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                        const void *src, size_t src_len,
+                        const void *dst, size_t dst_len,
+                        size_t size, uint16_t tag, bool cmp_size)
+{
+    if ((e->pkt == NULL) || (e->super.tag != tag) ||
+        (e->super.src_len != src_len) || (e->super.dst_len != dst_len)) {
+        return false;
+    }
+    /* not all SFR fragments carry the datagram size, so make 0 a legal value
+     * to not compare datagram size */
+    if (cmp_size &&
+        !(IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (size == 0)) &&
+        (e->super.datagram_size != size)) {
+        return false;
+    }
+    return (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    /* the datagram size is not part of the key, as SFR does not always know
+     * it and also changes it during reassembly */
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) ^ src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 33) ^ dst[i];
+    }
+    if (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE_EXP == 0) {
+        return 0;
+    }
+    /* Fibonacci hashing */
+    return (uint32_t)(hash * 2654435769UL) >>
+           ((32U - CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE_EXP) & 31U);
+}
+
+/* (re-)links a newly created entry into the bucket of its key */
+static void _rbuf_link(gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned idx = e - rbuf;
+    unsigned bucket = _rbuf_hash(e->super.src, e->super.src_len,
+                                 e->super.dst, e->super.dst_len,
+                                 e->super.tag);
+
+    if (_rbuf_bucket_of[idx] > 0) {
+        gnrc_sixlowpan_frag_rb_t **ptr;
+
+        ptr = &_rbuf_buckets[_rbuf_bucket_of[idx] - 1];
+        while (*ptr != e) {
+            ptr = &_rbuf_bucket_next[*ptr - rbuf];
+        }
+        *ptr = _rbuf_bucket_next[idx];
+    }
+    _rbuf_bucket_next[idx] = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = e;
+    _rbuf_bucket_of[idx] = bucket + 1;
+}
+
+/* lowers the bound for the arrival times of entries in use if needed */
+static void _rbuf_bound_arrival(uint32_t arrival)
+{
+    if (!_rbuf_oldest_valid ||
+        ((_rbuf_oldest_arrival - arrival) < UINT32_MAX / 2)) {
+        _rbuf_oldest_arrival = arrival;
+        _rbuf_oldest_valid = true;
+    }
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
+/* gets the entry in use for the given datagram with the lowest index */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            size_t size, uint16_t tag,
+                                            bool cmp_size)
+{
+    gnrc_sixlowpan_frag_rb_t *res = NULL;
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    gnrc_sixlowpan_frag_rb_t *e = _rbuf_buckets[_rbuf_hash(src, src_len,
+                                                           dst, dst_len,
+                                                           tag)];
+
+    for (; e != NULL; e = _rbuf_bucket_next[e - rbuf]) {
+        if (((res == NULL) || (e < res)) &&
+            _rbuf_match(e, src, src_len, dst, dst_len, size, tag, cmp_size)) {
+            res = e;
+        }
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (_rbuf_match(&rbuf[i], src, src_len, dst, dst_len, size, tag,
+                        cmp_size)) {
+            res = &rbuf[i];
+            break;
+        }
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+    return res;
+}
+
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag)
 {
@@ -189,18 +314,7 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
-
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_find(src, src_len, dst, dst_len, 0, tag, false);
 }
 
 #ifndef NDEBUG
@@ -365,7 +479,13 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     }
     else if ((res = _rbuf_get(src, netif_hdr->src_l2addr_len,
                               dst, netif_hdr->dst_l2addr_len,
-                              datagram_size, datagram_tag, page)) < 0) {
+                              datagram_size, datagram_tag, page,
+                              /* the RFC 4944 header carries the final
+                               * datagram size, so place all fragments into
+                               * it right away. If the datagram is forwarded
+                               * instead, the buffer is shrunk or released */
+                              IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_CUT_THROUGH) &&
+                              sixlowpan_frag_is(pkt->data))) < 0) {
         DEBUG("6lo rbuf: reassembly buffer full.\n");
         gnrc_pktbuf_release(pkt);
         return RBUF_ADD_ERROR;
@@ -459,7 +579,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
              * just do normal reassembly. For the `minfwd` case however, we need
              * to resize `entry.rbuf->pkt`, since we kept the packet allocation
              * with fragment forwarding as minimal as possible in
-             * `_rbuf_get()` */
+             * `_rbuf_get()`, unless the whole datagram was reserved there */
             res = _rbuf_resize_for_reassembly(entry.rbuf);
             if (res == RBUF_ADD_ERROR) {
                 gnrc_pktbuf_release(pkt);
@@ -490,11 +610,24 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    /* intervals are mostly freed in the order they were taken, so continue
+     * after the last one taken instead of always starting at the front */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = _rbuf_int_next;
+
+        _rbuf_int_next = (i + 1) % RBUF_INT_SIZE;
+        if (rbuf_int[i].end == 0) {
+            return rbuf_int + i;
+        }
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 
     return NULL;
 }
@@ -557,8 +690,19 @@ void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
-
-    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+    bool scan = true;
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    /* only go through the buffer if any entry in use may have timed out */
+    scan = _rbuf_oldest_valid &&
+           ((now_usec - _rbuf_oldest_arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US);
+    if (scan) {
+        /* recalculated from the entries that stay below */
+        _rbuf_oldest_valid = false;
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+    for (i = 0; scan && (i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE); i++) {
         /* since pkt occupies pktbuf, aggressivly collect garbage */
         if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
               ((now_usec - rbuf[i].super.arrival) >
@@ -576,6 +720,11 @@ void gnrc_sixlowpan_frag_rb_gc(void)
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+        else if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            _rbuf_bound_arrival(rbuf[i].super.arrival);
+        }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -591,46 +740,35 @@ static inline void _set_rbuf_timeout(void)
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
-                     unsigned page)
+                     unsigned page, bool reserve)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t *res, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    res = _rbuf_find(src, src_len, dst, dst_len, size, tag, true);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -683,7 +821,7 @@ static int _rbuf_get(const void *src, size_t src_len,
         default:
             reass_type = GNRC_NETTYPE_UNDEF;
     }
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB)) {
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) && !reserve) {
         if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC)) {
             /* only allocate enough space to decompress IPv6 header
              * for forwarding information */
@@ -699,7 +837,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     }
     else {
         /* reassemble whole datagram without direct fragment forwarding */
-        res->pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
+        res->pkt = gnrc_pktbuf_add_long_lived(NULL, NULL, size, reass_type);
     }
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
@@ -718,6 +856,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    _rbuf_link(res);
+    _rbuf_bound_arrival(now_usec);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -748,6 +890,12 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    memset(_rbuf_bucket_of, 0, sizeof(_rbuf_bucket_of));
+    _rbuf_oldest_valid = false;
+    _rbuf_int_next = 0;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -780,6 +928,9 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+        _rbuf_bound_arrival(rbuf->super.arrival);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -1035,55 +1035,9 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
-static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
-                                const gnrc_netif_hdr_t *netif_hdr,
-                                gnrc_netif_t *iface,
-                                uint8_t *iphc_hdr)
+static uint16_t _iphc_tf_nh_hl_encode(const ipv6_hdr_t *ipv6_hdr,
+                                      uint8_t *iphc_hdr, uint16_t inline_pos)
 {
-    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
-    bool addr_comp = false;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-
-    assert(iface != NULL);
-
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
-
-    /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
-        /* do not use source context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            src_ctx = NULL;
-        }
-    }
-
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
-        /* do not use destination context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            dst_ctx = NULL;
-        }
-    }
-
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
-
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
-    }
-
     /* compress flow label and traffic class */
     if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
         if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
@@ -1143,6 +1097,246 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             break;
     }
 
+    return inline_pos;
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+#define IPHC_CACHE_NO_CTX           (UINT8_MAX)
+
+/**
+ * @brief   Compressed addresses of a flow
+ *
+ * The address part of an IPHC header, i.e. the second IPHC byte, the CID
+ * extension, and the inline address fields, only depends on the addresses in
+ * the IPv6 header, the compression contexts, and the link-layer addresses, so
+ * it can be reused for every packet of the flow.
+ */
+typedef struct {
+    ipv6_addr_t src;            /**< source address of the flow */
+    ipv6_addr_t dst;            /**< destination address of the flow */
+    gnrc_netif_t *iface;        /**< interface of the flow, NULL if unused */
+    eui64_t src_iid;            /**< interface IID @p src was compressed with */
+    unsigned ctx_generation;    /**< context buffer generation of the entry */
+    uint8_t src_cid;            /**< ID of the source context or IPHC_CACHE_NO_CTX */
+    uint8_t dst_cid;            /**< ID of the destination context or IPHC_CACHE_NO_CTX */
+    uint8_t l2dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];   /**< link-layer destination */
+    uint8_t l2dst_len;          /**< length of _iphc_cache_t::l2dst */
+    uint8_t iphc2;              /**< second IPHC byte */
+    uint8_t cid_ext;            /**< CID extension, if indicated by _iphc_cache_t::iphc2 */
+    uint8_t addr_len;           /**< length of _iphc_cache_t::addr */
+    uint8_t addr[2 * sizeof(ipv6_addr_t)];  /**< inline address fields */
+} _iphc_cache_t;
+
+/* only ever accessed from the 6LoWPAN thread */
+static _iphc_cache_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _iphc_cache_next;
+
+static inline bool _iphc_cache_uses_src_iid(const ipv6_addr_t *src,
+                                            uint8_t iphc2)
+{
+    return !ipv6_addr_is_unspecified(src) &&
+           ((iphc2 & SIXLOWPAN_IPHC2_SAC) || ipv6_addr_is_link_local(src));
+}
+
+static inline uint8_t _iphc_cache_cid(const gnrc_sixlowpan_ctx_t *ctx)
+{
+    return (ctx == NULL) ? IPHC_CACHE_NO_CTX
+                         : (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+}
+
+static inline bool _iphc_cache_ctx_valid(uint8_t cid)
+{
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    if (cid == IPHC_CACHE_NO_CTX) {
+        return true;
+    }
+    ctx = gnrc_sixlowpan_ctx_lookup_id(cid);
+    /* the context might have expired since the entry was created */
+    return (ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP);
+}
+
+static bool _iphc_cache_valid(const _iphc_cache_t *entry, gnrc_netif_t *iface)
+{
+    /* contexts are only ever added, changed, or removed with a new generation,
+     * but expire silently */
+    if ((entry->ctx_generation != gnrc_sixlowpan_ctx_generation()) ||
+        !_iphc_cache_ctx_valid(entry->src_cid) ||
+        !_iphc_cache_ctx_valid(entry->dst_cid)) {
+        return false;
+    }
+    if (_iphc_cache_uses_src_iid(&entry->src, entry->iphc2)) {
+        eui64_t iid;
+        int res;
+
+        /* the link-layer address of the interface might have changed */
+        gnrc_netif_acquire(iface);
+        res = gnrc_netif_ipv6_get_iid(iface, &iid);
+        gnrc_netif_release(iface);
+        if ((res < 0) || (iid.uint64.u64 != entry->src_iid.uint64.u64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static _iphc_cache_t *_iphc_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                      const gnrc_netif_hdr_t *netif_hdr,
+                                      gnrc_netif_t *iface)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        _iphc_cache_t *entry = &_iphc_cache[i];
+
+        if ((entry->iface == iface) &&
+            ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) &&
+            ipv6_addr_equal(&entry->src, &ipv6_hdr->src) &&
+            (entry->l2dst_len == netif_hdr->dst_l2addr_len) &&
+            (memcmp(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    entry->l2dst_len) == 0)) {
+            if (_iphc_cache_valid(entry, iface)) {
+                return entry;
+            }
+            DEBUG("6lo iphc: flow cache entry %u is stale\n", i);
+            entry->iface = NULL;
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+static void _iphc_cache_add(const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface, const eui64_t *src_iid,
+                            unsigned ctx_generation,
+                            const gnrc_sixlowpan_ctx_t *src_ctx,
+                            const gnrc_sixlowpan_ctx_t *dst_ctx,
+                            const uint8_t *iphc_hdr,
+                            uint16_t addr_pos, uint16_t inline_pos)
+{
+    _iphc_cache_t *entry = NULL;
+    uint8_t iphc2 = iphc_hdr[IPHC2_IDX];
+
+    if ((netif_hdr->dst_l2addr_len > sizeof(entry->l2dst)) ||
+        /* unicast-prefix based multicast destinations are rare, do not
+         * bother to cache their context */
+        ((iphc2 & SIXLOWPAN_IPHC2_M) && (iphc2 & SIXLOWPAN_IPHC2_DAC))) {
+        return;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        if (_iphc_cache[i].iface == NULL) {
+            entry = &_iphc_cache[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &_iphc_cache[_iphc_cache_next];
+        _iphc_cache_next = (_iphc_cache_next + 1) %
+                           CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    }
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->iface = iface;
+    entry->src_iid = *src_iid;
+    entry->ctx_generation = ctx_generation;
+    entry->src_cid = _iphc_cache_cid(src_ctx);
+    entry->dst_cid = _iphc_cache_cid(dst_ctx);
+    entry->l2dst_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           entry->l2dst_len);
+    entry->iphc2 = iphc2;
+    entry->cid_ext = (iphc2 & SIXLOWPAN_IPHC2_CID_EXT) ? iphc_hdr[CID_EXT_IDX]
+                                                       : 0;
+    /* the inline address fields are the last fields of the IPHC header */
+    entry->addr_len = inline_pos - addr_pos;
+    memcpy(entry->addr, &iphc_hdr[addr_pos], entry->addr_len);
+}
+
+static size_t _iphc_cache_encode(const _iphc_cache_t *entry,
+                                 const ipv6_hdr_t *ipv6_hdr,
+                                 uint8_t *iphc_hdr)
+{
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = entry->iphc2;
+    if (entry->iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
+        iphc_hdr[CID_EXT_IDX] = entry->cid_ext;
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    inline_pos = _iphc_tf_nh_hl_encode(ipv6_hdr, iphc_hdr, inline_pos);
+    memcpy(&iphc_hdr[inline_pos], entry->addr, entry->addr_len);
+    return inline_pos + entry->addr_len;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
+                                const gnrc_netif_hdr_t *netif_hdr,
+                                gnrc_netif_t *iface,
+                                uint8_t *iphc_hdr)
+{
+    gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
+    ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+    bool addr_comp = false;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    eui64_t src_iid = { .uint64.u64 = 0 };
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    /* get generation first, so context changes during compression make the
+     * new cache entry stale */
+    unsigned ctx_generation = gnrc_sixlowpan_ctx_generation();
+    _iphc_cache_t *entry;
+    uint16_t addr_pos;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+    assert(iface != NULL);
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    if ((entry = _iphc_cache_get(ipv6_hdr, netif_hdr, iface)) != NULL) {
+        return _iphc_cache_encode(entry, ipv6_hdr, iphc_hdr);
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = 0;
+
+    /* check for available contexts */
+    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
+        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+        /* do not use source context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            src_ctx = NULL;
+        }
+    }
+
+    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+        /* do not use destination context for compression if */
+        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+            dst_ctx = NULL;
+        }
+    }
+
+    /* if contexts available and both != 0 */
+    /* since this moves inline_pos we have to do this ahead*/
+    if (((src_ctx != NULL) &&
+            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
+        ((dst_ctx != NULL) &&
+            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
+        /* add context identifier extension */
+        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+        iphc_hdr[CID_EXT_IDX] = 0;
+
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    inline_pos = _iphc_tf_nh_hl_encode(ipv6_hdr, iphc_hdr, inline_pos);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    addr_pos = inline_pos;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
     }
@@ -1157,19 +1351,16 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
 
         if ((src_ctx != NULL) || ipv6_addr_is_link_local(&(ipv6_hdr->src))) {
-            eui64_t iid;
-            iid.uint64.u64 = 0;
-
             gnrc_netif_acquire(iface);
-            if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
+            if (gnrc_netif_ipv6_get_iid(iface, &src_iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
                 return 0;
             }
             gnrc_netif_release(iface);
 
-            if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
-                _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
+            if ((ipv6_hdr->src.u64[1].u64 == src_iid.uint64.u64) ||
+                _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &src_iid)) {
                 /* 0 bits. The address is derived from link-layer address */
                 iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_L2;
                 addr_comp = true;
@@ -1315,6 +1506,10 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    _iphc_cache_add(ipv6_hdr, netif_hdr, iface, &src_iid, ctx_generation,
+                    src_ctx, dst_ctx, iphc_hdr, addr_pos, inline_pos);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
     return inline_pos;
 }
 
@@ -23,6 +23,8 @@
 #include <stdio.h>
 #include <sys/types.h>
 
+#include "irq.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 #include "od.h"
 #include "utlist.h"
@@ -43,15 +45,154 @@ static uintptr_t _pktbuf_buf[CONFIG_GNRC_PKTBUF_SIZE / sizeof(uintptr_t)];
 uint8_t *gnrc_pktbuf_static_buf = (uint8_t *)_pktbuf_buf;
 static _unused_t *_first_unused;
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+#define SLAB_SIZE(size)         (((size) + GNRC_PKTBUF_STATIC_ALIGN_MASK) & \
+                                 ~(GNRC_PKTBUF_STATIC_ALIGN_MASK))
+#define SLAB_SNIP_SIZE          SLAB_SIZE(sizeof(gnrc_pktsnip_t))
+#define SLAB_SMALL_SIZE         SLAB_SIZE(CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_SIZE)
+#define SLAB_HDR_SIZE           SLAB_SIZE(CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_SIZE)
+#define SLAB_POOL_SIZE          ((SLAB_SNIP_SIZE * CONFIG_GNRC_PKTBUF_STATIC_SLAB_SNIP_NUMOF) + \
+                                 (SLAB_SMALL_SIZE * CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_NUMOF) + \
+                                 (SLAB_HDR_SIZE * CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_NUMOF))
+
+/* the slabs are taken from the end of the packet buffer, the first-fit arena
+ * gets the rest */
+#define ARENA_SIZE              ((CONFIG_GNRC_PKTBUF_SIZE - SLAB_POOL_SIZE) & \
+                                 ~(GNRC_PKTBUF_STATIC_ALIGN_MASK))
+
+static_assert(SLAB_POOL_SIZE < CONFIG_GNRC_PKTBUF_SIZE,
+              "pktbuf slabs do not fit into CONFIG_GNRC_PKTBUF_SIZE");
+#else
+#define ARENA_SIZE              CONFIG_GNRC_PKTBUF_SIZE
+#endif
+
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
 #endif
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+/**
+ * @brief   A size class of fixed-size slabs
+ */
+typedef struct {
+    _unused_t *free;        /**< free slabs, linked by _unused_t::next */
+    uint8_t *start;         /**< first slab of this class */
+    uint16_t size;          /**< size of a slab in bytes */
+    uint16_t numof;         /**< number of slabs of this class */
+} _slab_class_t;
+
+static _slab_class_t _slabs[] = {
+    { .size = SLAB_SNIP_SIZE, .numof = CONFIG_GNRC_PKTBUF_STATIC_SLAB_SNIP_NUMOF },
+    { .size = SLAB_SMALL_SIZE, .numof = CONFIG_GNRC_PKTBUF_STATIC_SLAB_SMALL_NUMOF },
+    { .size = SLAB_HDR_SIZE, .numof = CONFIG_GNRC_PKTBUF_STATIC_SLAB_HDR_NUMOF },
+};
+
+#ifdef DEVELHELP
+/* number of allocations served by slabs */
+static uint32_t slab_hits = 0;
+/* number of allocations that fit a size class but went to the arena */
+static uint32_t slab_misses = 0;
+#endif
+
+static inline bool _in_slab(const void *ptr)
+{
+    return ((uint8_t *)ptr >= &gnrc_pktbuf_static_buf[ARENA_SIZE]) &&
+           ((uint8_t *)ptr < &gnrc_pktbuf_static_buf[ARENA_SIZE + SLAB_POOL_SIZE]);
+}
+
+static inline bool _slab_fits(size_t size)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        if ((_slabs[i].numof > 0) && (size <= _slabs[i].size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _slab_init(void)
+{
+    uint8_t *start = &gnrc_pktbuf_static_buf[ARENA_SIZE];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_class_t *class = &_slabs[i];
+
+        class->start = start;
+        class->free = NULL;
+        /* build the free list backwards, so slabs are handed out in order */
+        for (unsigned j = class->numof; j > 0; j--) {
+            _unused_t *slab = (_unused_t *)(uintptr_t)(start + ((j - 1) * class->size));
+
+            slab->next = class->free;
+            slab->size = class->size;
+            class->free = slab;
+        }
+        start += class->numof * class->size;
+    }
+}
+
+/* takes a slab from the smallest non-empty class that fits size, does not
+ * need gnrc_pktbuf_mutex */
+static void *_slab_alloc(size_t size)
+{
+    _slab_class_t *best = NULL;
+    _unused_t *slab = NULL;
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_class_t *class = &_slabs[i];
+
+        if ((class->free != NULL) && (size <= class->size) &&
+            ((best == NULL) || (class->size < best->size))) {
+            best = class;
+        }
+    }
+    if (best != NULL) {
+        slab = best->free;
+        best->free = slab->next;
+#ifdef DEVELHELP
+        slab_hits++;
+#endif
+    }
+    irq_restore(state);
+    return slab;
+}
+
+static void _slab_free(void *data)
+{
+    _unused_t *slab = data;
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_class_t *class = &_slabs[i];
+
+        if ((uint8_t *)data < (class->start + (class->numof * class->size))) {
+            assert(((uint8_t *)data - class->start) % class->size == 0);
+            slab->next = class->free;
+            slab->size = class->size;
+            class->free = slab;
+            break;
+        }
+    }
+    irq_restore(state);
+}
+
+/* fast path of gnrc_pktbuf_add(): snip and data both come from slabs */
+static gnrc_pktsnip_t *_slab_create_snip(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, gnrc_nettype_t type);
+#else
+static inline bool _in_slab(const void *ptr)
+{
+    (void)ptr;
+    return false;
+}
+#endif
+
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
-                                    gnrc_nettype_t type);
-static void *_pktbuf_alloc(size_t size);
+                                    gnrc_nettype_t type, bool long_lived);
+static void *_pktbuf_alloc(size_t size, bool long_lived);
 
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
@@ -71,7 +212,10 @@ void gnrc_pktbuf_init(void)
     mutex_lock(&gnrc_pktbuf_mutex);
     _first_unused = (_unused_t *)_pktbuf_buf;
     _first_unused->next = NULL;
-    _first_unused->size = sizeof(_pktbuf_buf);
+    _first_unused->size = ARENA_SIZE;
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    _slab_init();
+#endif
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -85,12 +229,38 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
               (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
         return NULL;
     }
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    /* slabs are protected by disabling IRQs for a few instructions, so this
+     * does not need to wait for other threads walking the arena */
+    pkt = _slab_create_snip(next, data, size, type);
+    if (pkt != NULL) {
+        return pkt;
+    }
+#endif
     mutex_lock(&gnrc_pktbuf_mutex);
-    pkt = _create_snip(next, data, size, type);
+    pkt = _create_snip(next, data, size, type, false);
     mutex_unlock(&gnrc_pktbuf_mutex);
     return pkt;
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_BESTFIT)
+gnrc_pktsnip_t *gnrc_pktbuf_add_long_lived(gnrc_pktsnip_t *next, const void *data,
+                                           size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > CONFIG_GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type, true);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+#endif
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
@@ -108,24 +278,24 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         return NULL;
     }
     /* create new snip descriptor for marked data */
-    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t), false);
     if (marked_snip == NULL) {
         DEBUG("pktbuf: could not reallocate marked section.\n");
         mutex_unlock(&gnrc_pktbuf_mutex);
         return NULL;
     }
-    /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+    /* marked data would not fit _unused_t marker or data is a slab that can
+     * not be split => move data around to allow for proper free */
+    if ((pkt->size != size) && ((size < required_new_size) || _in_slab(pkt->data))) {
         void *new_data_rest;
-        new_data_marked = _pktbuf_alloc(size);
+        new_data_marked = _pktbuf_alloc(size, false);
         if (new_data_marked == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
             gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
             mutex_unlock(&gnrc_pktbuf_mutex);
             return NULL;
         }
-        new_data_rest = _pktbuf_alloc(pkt->size - size);
+        new_data_rest = _pktbuf_alloc(pkt->size - size, false);
         if (new_data_rest == NULL) {
             DEBUG("pktbuf: could not reallocate remaining section.\n");
             gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
@@ -174,7 +344,7 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     }
     /* if new size is bigger than old size */
     else if (size > pkt->size) {    /* new size does not fit */
-        void *new_data = _pktbuf_alloc(size);
+        void *new_data = _pktbuf_alloc(size, false);
         if (new_data == NULL) {
             DEBUG("pktbuf: error allocating new data section\n");
             mutex_unlock(&gnrc_pktbuf_mutex);
@@ -186,7 +356,8 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
+    /* slabs are only ever freed as a whole */
+    else if ((_align(pkt->size) > aligned_size) && !_in_slab(pkt->data)) {
         gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
                      pkt->size - aligned_size);
     }
@@ -214,7 +385,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
     }
     if (pkt->users > 1) {
         gnrc_pktsnip_t *new;
-        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type, false);
         if (new != NULL) {
             pkt->users--;
         }
@@ -256,18 +427,47 @@ static inline void _print_unused(_unused_t *ptr)
 
 void gnrc_pktbuf_stats(void)
 {
-#ifdef MODULE_OD
     _unused_t *ptr = _first_unused;
-    uint8_t *chunk = &gnrc_pktbuf_static_buf[0];
-    int count = 0;
+    size_t free_bytes = 0, largest = 0;
 
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
            (void *)&gnrc_pktbuf_static_buf[0],
            (void *)&gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
            CONFIG_GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    for (; ptr != NULL; ptr = ptr->next) {
+        free_bytes += ptr->size;
+        if (ptr->size > largest) {
+            largest = ptr->size;
+        }
+    }
+    /* share of free bytes outside of the largest free chunk, 0 % means all
+     * free space is contiguous */
+    printf("  free bytes: %u, largest free chunk: %u, fragmentation: %u %%\n",
+           (unsigned)free_bytes, (unsigned)largest,
+           free_bytes ? (unsigned)(((free_bytes - largest) * 100) / free_bytes) : 0);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    printf("  slab hits: %" PRIu32 ", slab misses: %" PRIu32 "\n",
+           slab_hits, slab_misses);
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        unsigned state = irq_disable();
+        unsigned free = 0;
+
+        for (_unused_t *slab = _slabs[i].free; slab != NULL; slab = slab->next) {
+            free++;
+        }
+        irq_restore(state);
+        printf("  slab class %u: size: %4u, free: %u/%u\n", i,
+               _slabs[i].size, free, _slabs[i].numof);
+    }
+#endif
+#ifdef MODULE_OD
+    uint8_t *chunk = &gnrc_pktbuf_static_buf[0];
+    int count = 0;
+
+    ptr = _first_unused;
     if (ptr == NULL) {  /* packet buffer is completely full */
-        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
+        _print_chunk(chunk, ARENA_SIZE, count++);
     }
 
     if (((void *)ptr) == ((void *)chunk)) { /* _first_unused is at the beginning */
@@ -279,7 +479,7 @@ void gnrc_pktbuf_stats(void)
     while (ptr) {
         size_t size = ((uint8_t *)ptr) - chunk;
         if ((size == 0) && (!gnrc_pktbuf_contains(ptr)) &&
-            (!gnrc_pktbuf_contains(chunk)) && (size > CONFIG_GNRC_PKTBUF_SIZE)) {
+            (!gnrc_pktbuf_contains(chunk)) && (size > ARENA_SIZE)) {
             puts("ERROR");
             return;
         }
@@ -289,20 +489,37 @@ void gnrc_pktbuf_stats(void)
         ptr = ptr->next;
     }
 
-    if (chunk <= &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
-        _print_chunk(chunk, &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
+    if (chunk <= &gnrc_pktbuf_static_buf[ARENA_SIZE - 1]) {
+        _print_chunk(chunk, &gnrc_pktbuf_static_buf[ARENA_SIZE] - chunk, count);
     }
 #else
-    DEBUG("pktbuf: needs od module\n");
+    DEBUG("pktbuf: chunk dump needs od module\n");
 #endif
 }
 #endif
 
 #ifdef TEST_SUITES
+static bool _slabs_all_free(void)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        unsigned free = 0;
+
+        for (_unused_t *slab = _slabs[i].free; slab != NULL; slab = slab->next) {
+            free++;
+        }
+        if (free != _slabs[i].numof) {
+            return false;
+        }
+    }
+#endif
+    return true;
+}
+
 bool gnrc_pktbuf_is_empty(void)
 {
     return ((uintptr_t)_first_unused == (uintptr_t)gnrc_pktbuf_static_buf) &&
-           (_first_unused->size == sizeof(_pktbuf_buf));
+           (_first_unused->size == ARENA_SIZE) && _slabs_all_free();
 }
 
 bool gnrc_pktbuf_is_sane(void)
@@ -313,16 +530,16 @@ bool gnrc_pktbuf_is_sane(void)
      *  - the head of _unused_t list is _first_unused
      *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
      *  - forall ptr_in _unused_t list: &gnrc_pktbuf_static_buf[0] < ptr
-     *                                  && ptr < &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE]
+     *                                  && ptr < &gnrc_pktbuf_static_buf[ARENA_SIZE]
      *  - forall ptr in _unused_t list: ptr->next == NULL || ptr < ptr->next
      *  - forall ptr in _unused_t list: (ptr->next != NULL && ptr->size <= (ptr->next - ptr)) ||
      *                                  (ptr->next == NULL
-     *                                  && ptr->size == (CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))
+     *                                  && ptr->size == (ARENA_SIZE - pos_in_buf))
      */
 
     while (ptr) {
         if ((&gnrc_pktbuf_static_buf[0] >= (uint8_t *)ptr)
-            && ((uint8_t *)ptr >= &gnrc_pktbuf_static_buf[CONFIG_GNRC_PKTBUF_SIZE])) {
+            && ((uint8_t *)ptr >= &gnrc_pktbuf_static_buf[ARENA_SIZE])) {
             return false;
         }
         if ((ptr->next != NULL) && (ptr >= ptr->next)) {
@@ -330,7 +547,7 @@ bool gnrc_pktbuf_is_sane(void)
         }
         size_t pos_in_buf = (uint8_t *)ptr - &gnrc_pktbuf_static_buf[0];
         if (((ptr->next == NULL) || (ptr->size > (size_t)((uint8_t *)(ptr->next) - (uint8_t *)ptr)))
-            && ((ptr->next != NULL) || (ptr->size != CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))) {
+            && ((ptr->next != NULL) || (ptr->size != ARENA_SIZE - pos_in_buf))) {
             return false;
         }
         ptr = ptr->next;
@@ -341,9 +558,9 @@ bool gnrc_pktbuf_is_sane(void)
 #endif
 
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
-                                    gnrc_nettype_t type)
+                                    gnrc_nettype_t type, bool long_lived)
 {
-    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t), long_lived);
     void *_data = NULL;
 
     if (pkt == NULL) {
@@ -351,7 +568,7 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
         return NULL;
     }
     if (size > 0) {
-        _data = _pktbuf_alloc(size);
+        _data = _pktbuf_alloc(size, long_lived);
         if (_data == NULL) {
             DEBUG("pktbuf: error allocating data for new packet snip\n");
             gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
@@ -365,21 +582,95 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
-static void *_pktbuf_alloc(size_t size)
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+static gnrc_pktsnip_t *_slab_create_snip(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+    void *_data = NULL;
+
+    /* check the data first, a miss there is cheaper to roll back */
+    if (size > 0) {
+        _data = _slab_alloc(size);
+        if (_data == NULL) {
+            return NULL;
+        }
+    }
+    pkt = _slab_alloc(sizeof(gnrc_pktsnip_t));
+    if (pkt == NULL) {
+        if (_data != NULL) {
+            _slab_free(_data);
+        }
+        return NULL;
+    }
+    if ((_data != NULL) && (data != NULL)) {
+        memcpy(_data, data, size);
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+#endif
+
+static void *_pktbuf_alloc(size_t size, bool long_lived)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
+    void *res;
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    /* keep the slabs for the short-lived bulk of allocations */
+    ptr = long_lived ? NULL : _slab_alloc(size);
+    if (ptr != NULL) {
+        return ptr;
+    }
+#ifdef DEVELHELP
+    if (!long_lived && _slab_fits(size)) {
+        slab_misses++;
+    }
+#endif
+    ptr = _first_unused;
+#endif
     size = _align(size);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_BESTFIT)
+    /* short-lived allocations take the smallest chunk that fits, the lowest
+     * one on ties. Long-lived allocations take the highest chunk that fits */
+    _unused_t *best = NULL, *best_prev = NULL;
+
+    for (; ptr != NULL; prev = ptr, ptr = ptr->next) {
+        if ((size <= ptr->size) &&
+            (long_lived || (best == NULL) || (ptr->size < best->size))) {
+            best = ptr;
+            best_prev = prev;
+            if (!long_lived && (ptr->size == size)) {
+                break;
+            }
+        }
+    }
+    ptr = best;
+    prev = best_prev;
+#else
     while (ptr && (size > ptr->size)) {
         prev = ptr;
         ptr = ptr->next;
     }
+#endif
     if (ptr == NULL) {
         DEBUG("pktbuf: no space left in packet buffer\n");
         return NULL;
     }
+    res = ptr;
+    /* long-lived allocations are cut from the end of the chunk, so they pile
+     * up at the end of the packet buffer while short-lived allocations are
+     * made from its start. The rest of the chunk stays in place, its size may
+     * only be unaligned at the very end of the packet buffer */
+    size_t rest = (ptr->size - size) & ~(GNRC_PKTBUF_STATIC_ALIGN_MASK);
+
+    if (long_lived && (rest >= sizeof(_unused_t))) {
+        res = ((uint8_t *)ptr) + rest;
+        size = ptr->size - rest;
+        ptr->size = rest;
+    }
     /* _unused_t struct would fit => add new space at ptr */
-    if (sizeof(_unused_t) > (ptr->size - size)) {
+    else if (sizeof(_unused_t) > (ptr->size - size)) {
         if (prev == NULL) { /* ptr was _first_unused */
             _first_unused = ptr->next;
         }
@@ -393,7 +684,7 @@ static void *_pktbuf_alloc(size_t size)
         _unused_t *new = (_unused_t *)((uintptr_t)ptr + size);
 
         if (((((uint8_t *)new) - &(gnrc_pktbuf_static_buf[0])) + sizeof(_unused_t))
-            > CONFIG_GNRC_PKTBUF_SIZE) {
+            > ARENA_SIZE) {
             /* content of new would exceed packet buffer size so set to NULL */
             _first_unused = NULL;
         }
@@ -407,12 +698,12 @@ static void *_pktbuf_alloc(size_t size)
         new->size = ptr->size - size;
     }
 #ifdef DEVELHELP
-    uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(gnrc_pktbuf_static_buf[0]));
+    uint16_t last_byte = (uint16_t)((((uint8_t *)res) + size) - &(gnrc_pktbuf_static_buf[0]));
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
     }
 #endif
-    return (void *)ptr;
+    return res;
 }
 
 static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
@@ -437,6 +728,12 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
     if (!gnrc_pktbuf_contains(data)) {
         return;
     }
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB)
+    if (_in_slab(data)) {
+        _slab_free(data);
+        return;
+    }
+#endif
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
@@ -445,7 +742,7 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
     new->size = _align(size);
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
-    bytes_at_end = ((&gnrc_pktbuf_static_buf[0] + CONFIG_GNRC_PKTBUF_SIZE)
+    bytes_at_end = ((&gnrc_pktbuf_static_buf[0] + ARENA_SIZE)
                    - (((uint8_t *)new) + new->size));
     if (bytes_at_end < sizeof(_unused_t)) {
         /* new is very last segment and there is a little bit of memory left
@@ -325,6 +325,20 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *congure)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    mutex_lock(&(tcb->function_lock));
+    assert(_gnrc_tcp_fsm_get_state(tcb) == FSM_STATE_CLOSED);
+    tcb->congure = congure;
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
 {
     TCP_DEBUG_ENTER;
@@ -660,10 +674,22 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
 
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t timeout_duration_ms)
+{
+    assert(data != NULL);
+
+    iolist_t iolist = {
+        .iol_next = NULL,
+        .iol_base = (void *) data,
+        .iol_len = len,
+    };
+    return gnrc_tcp_send_iolist(tcb, &iolist, timeout_duration_ms);
+}
+
+ssize_t gnrc_tcp_send_iolist(gnrc_tcp_tcb_t *tcb, const iolist_t *iolist,
+                             const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
     assert(tcb != NULL);
-    assert(data != NULL);
 
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
@@ -688,6 +714,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     }
 
     /* Early return for zero length payloads to send */
+    size_t len = iolist_size(iolist);
     if (!len) {
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
@@ -705,8 +732,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Send as much as the send window allows, the FSM sends the rest as ACKs arrive */
+    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) iolist, len);
+
+    /* Loop until everything was sent and acked */
+    while (ret == 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -716,6 +746,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
             break;
         }
 
+        /* The FSM releases the buffer after everything was acknowledged */
+        if (tcb->snd_buf == NULL) {
+            ret = len;
+            break;
+        }
+
         /* If the send window is closed: Setup Probing */
         if (tcb->snd_wnd <= 0) {
             /* If this is the first probe: Setup probing duration */
@@ -729,11 +765,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
-        }
-
         /* Wait for responses */
         mbox_get(&mbox, &msg);
         switch (msg.type) {
@@ -746,9 +777,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
-                TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
-                ret = -ETIMEDOUT;
+                /* Report acknowledged data, if there is any */
+                ret = tcb->snd_una - tcb->snd_buf_seq;
+                if (ret <= 0) {
+                    TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
+                    ret = -ETIMEDOUT;
+                }
                 break;
 
             case MSG_TYPE_PROBE_TIMEOUT:
@@ -785,6 +819,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         }
     }
 
+    /* Stop sending and release the callers buffer */
+    if (tcb->snd_buf != NULL) {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+    }
+
     /* Cleanup */
     _gnrc_tcp_fsm_set_mbox(tcb, NULL);
     _unsched_mbox(&tcb->event_misc);
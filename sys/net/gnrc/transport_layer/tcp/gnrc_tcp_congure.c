@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+#include "clist.h"
+#include "evtimer.h"
+#include "kernel_defines.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+
+/**
+ * @brief Reports all data segments with one of the given flags set (or all
+ *        data segments without SEG_SACKED if @p flags is 0) to @p report.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     flags    Flags of the segments to report.
+ * @param[in]     report   Method of the CongURE driver to call.
+ */
+static void _report(gnrc_tcp_tcb_t *tcb, uint8_t flags,
+                    void (*report)(congure_snd_t *, congure_snd_msg_t *))
+{
+    congure_snd_msg_t msgs[CONFIG_GNRC_TCP_SND_QUEUE_SIZE];
+    clist_node_t list = { .next = NULL };
+
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        const gnrc_tcp_seg_t *seg = &tcb->snd_queue[i];
+
+        if ((seg->len == 0) ||
+            (flags ? !(seg->flags & flags) : (seg->flags & SEG_SACKED))) {
+            continue;
+        }
+        msgs[i].send_time = seg->sent;
+        msgs[i].size = seg->len;
+        msgs[i].resends = (seg->flags & SEG_RETRANSMITTED) ? 1 : 0;
+        clist_rpush(&list, &msgs[i].super);
+    }
+    if (list.next != NULL) {
+        report(tcb->congure, (congure_snd_msg_t *)list.next);
+    }
+}
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->recover = tcb->snd_nxt;
+    if (tcb->congure != NULL) {
+        tcb->congure->driver->init(tcb->congure, tcb);
+    }
+}
+
+uint32_t _gnrc_tcp_congure_wnd(const gnrc_tcp_tcb_t *tcb, uint32_t wnd)
+{
+    if ((tcb->congure != NULL) && (tcb->congure->cwnd < wnd)) {
+        return tcb->congure->cwnd;
+    }
+    return wnd;
+}
+
+void _gnrc_tcp_congure_sent(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_seg_t *seg)
+{
+    if ((tcb->congure != NULL) && (seg->len > 0)) {
+        tcb->congure->driver->report_msg_sent(tcb->congure, seg->len);
+    }
+}
+
+void _gnrc_tcp_congure_acked(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_seg_t *seg,
+                             uint32_t ack)
+{
+    if ((tcb->congure == NULL) || (seg->len == 0)) {
+        return;
+    }
+
+    congure_snd_msg_t msg = {
+        .send_time = seg->sent,
+        .size = seg->len,
+        .resends = (seg->flags & SEG_RETRANSMITTED) ? 1 : 0,
+    };
+    congure_snd_ack_t cack = {
+        .recv_time = evtimer_now_msec(),
+        .id = ack,
+        .wnd = tcb->snd_wnd,
+        .clean = 1,
+    };
+    tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &cack);
+}
+
+void _gnrc_tcp_congure_lost(gnrc_tcp_tcb_t *tcb)
+{
+    /* React only once to losses within the same window of data (RFC 6582) */
+    if ((tcb->congure == NULL) || LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+        return;
+    }
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        if (tcb->snd_queue[i].flags & SEG_LOST) {
+            _report(tcb, SEG_LOST, tcb->congure->driver->report_msgs_lost);
+            tcb->recover = tcb->snd_nxt;
+            break;
+        }
+    }
+}
+
+void _gnrc_tcp_congure_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->congure != NULL) {
+        _report(tcb, 0, tcb->congure->driver->report_msgs_timeout);
+        tcb->recover = tcb->snd_nxt;
+    }
+}
+
+void _gnrc_tcp_congure_discard(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->congure == NULL) {
+        return;
+    }
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        const gnrc_tcp_seg_t *seg = &tcb->snd_queue[i];
+
+        if ((seg->len > 0) && !(seg->flags & SEG_SACKED)) {
+            tcb->congure->driver->report_msg_discarded(tcb->congure, seg->len);
+        }
+    }
+}
+
+#endif /* MODULE_GNRC_TCP_CONGURE */
@@ -25,10 +25,12 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_rcvbuf.h"
+#include "include/gnrc_tcp_sack.h"
 #include "include/gnrc_tcp_fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -92,15 +94,70 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->snd_queue_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+#ifdef MODULE_GNRC_TCP_CONGURE
+        _gnrc_tcp_congure_discard(tcb);
+#endif
+        tcb->snd_queue_len = 0;
+    }
+    /* Unacknowledged data of the send call is not retransmitted anymore:
+     * Continue with the next send call right after the acknowledged data,
+     * leaving no gap in the sequence space */
+    if (tcb->snd_buf != NULL) {
+        tcb->snd_nxt = tcb->snd_una;
+        tcb->retries = 0;
+#ifdef MODULE_GNRC_TCP_CONGURE
+        tcb->recover = tcb->snd_una;
+#endif
     }
+    /* Do not reference the callers buffer any longer */
+    tcb->snd_buf = NULL;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Sends data of the ongoing send call, as far as the send window and
+ *        the send queue allow.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @return   Number of bytes sent.
+ */
+static size_t _send_data(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    size_t sent = 0;
+
+    while (tcb->snd_buf != NULL) {
+        size_t left = tcb->snd_buf_len - (tcb->snd_nxt - tcb->snd_buf_seq);
+        uint32_t snd_wnd = tcb->snd_wnd;
+#ifdef MODULE_GNRC_TCP_CONGURE
+        snd_wnd = _gnrc_tcp_congure_wnd(tcb, snd_wnd);
+#endif
+        int32_t wnd = (int32_t)((tcb->snd_una + snd_wnd) - tcb->snd_nxt);
+
+        /* Check if window is open and all data was transmitted */
+        if (left == 0 || wnd <= 0) {
+            break;
+        }
+
+        /* Calculate segment size */
+        size_t payload = (size_t)wnd;
+        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
+        payload = (payload < tcb->mss) ? payload : tcb->mss;
+        payload = (payload < left) ? payload : left;
+        if (payload == 0 ||
+            _gnrc_tcp_pkt_send_seg(tcb, MSK_ACK | MSK_PSH, payload) < 0) {
+            break;
+        }
+        sent += payload;
+    }
+    TCP_DEBUG_LEAVE;
+    return sent;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -150,6 +207,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
         case FSM_STATE_CLOSED:
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
+#ifdef MODULE_GNRC_TCP_SACK
+            /* Drop data received out of order */
+            _gnrc_tcp_sack_release(tcb);
+#endif
+            tcb->status &= ~STATUS_SACK_PERMITTED;
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -232,6 +294,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+#ifdef MODULE_GNRC_TCP_CONGURE
+            /* Start congestion control */
+            _gnrc_tcp_congure_init(tcb);
+#endif
+            /* fall through */
         case FSM_STATE_CLOSE_WAIT:
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
@@ -294,12 +361,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         }
 
         /* Send SYN */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN, tcb->iss, 0,
-                            NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        _gnrc_tcp_pkt_send_seg(tcb, MSK_SYN, 0);
     }
     TCP_DEBUG_LEAVE;
     return ret;
@@ -309,35 +371,22 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
  * @brief FSM Handling function for sending data.
  *
  * @param[in,out] tcb   TCB holding the connection information.
- * @param[in,out] buf   Buffer containing data to send.
- * @param[in]     len   Maximum Number of Bytes to send from @p buf.
+ * @param[in]     buf   Iolist containing data to send.
+ * @param[in]     len   Number of bytes in @p buf.
  *
- * @returns   Number of successfully transmitted bytes.
+ * @returns   Number of bytes sent right away. The remaining data is sent as
+ *            the send window allows, the TCB references @p buf until all
+ *            data was acknowledged.
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
-
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
-        /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
-
-        /* Calculate payload size for this segment */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
-    }
+    tcb->snd_buf = buf;
+    tcb->snd_buf_len = len;
+    tcb->snd_buf_seq = tcb->snd_nxt;
+    size_t sent = _send_data(tcb);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -391,12 +440,7 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
         tcb->state == FSM_STATE_CLOSE_WAIT) {
 
         /* Send FIN packet */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        _gnrc_tcp_pkt_send_seg(tcb, MSK_FIN_ACK, 0);
     }
 
     if (tcb->state == FSM_STATE_LISTEN) {
@@ -575,10 +619,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_wnd = seg_wnd;
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
-            _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
-                                tcb->rcv_nxt, NULL, 0);
-            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-            _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+            _gnrc_tcp_pkt_send_seg(tcb, MSK_SYN_ACK, 0);
             _transition_to(tcb, FSM_STATE_SYN_RCVD);
         }
         TCP_DEBUG_LEAVE;
@@ -635,12 +676,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 _transition_to(tcb, FSM_STATE_ESTABLISHED);
             }
-            /* Simultaneous SYN received. Send SYN+ACK, T: SYN_SENT -> SYN_RCVD */
+            /* Simultaneous SYN received. Resend SYN as SYN+ACK, T: SYN_SENT -> SYN_RCVD */
             else {
-                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK,
-                                    tcb->iss, tcb->rcv_nxt, NULL, 0);
-                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                tcb->snd_queue[0].ctl = MSK_SYN_ACK;
+                tcb->snd_queue[0].flags |= SEG_LOST;
+                _gnrc_tcp_pkt_retransmit_lost(tcb);
                 _transition_to(tcb, FSM_STATE_SYN_RCVD);
             }
             tcb->snd_wnd = seg_wnd;
@@ -735,28 +775,45 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->status |= STATUS_NOTIFY_USER;
                     }
                 }
+                /* Retransmit lost segments, send more data if the window allows */
+#ifdef MODULE_GNRC_TCP_SACK
+                _gnrc_tcp_sack_mark_lost(tcb);
+#endif
+#ifdef MODULE_GNRC_TCP_CONGURE
+                _gnrc_tcp_congure_lost(tcb);
+#endif
+                _gnrc_tcp_pkt_retransmit_lost(tcb);
+                _send_data(tcb);
+
+                /* Release the callers buffer once everything was acknowledged */
+                if (tcb->snd_buf != NULL &&
+                    tcb->snd_una == tcb->snd_buf_seq + tcb->snd_buf_len) {
+                    tcb->snd_buf = NULL;
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -782,11 +839,21 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+#ifdef MODULE_GNRC_TCP_SACK
+                    /* Append data that was received out of order before */
+                    _gnrc_tcp_sack_drain(tcb);
+#endif
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+#ifdef MODULE_GNRC_TCP_SACK
+                /* Hold back data beyond a gap, the ACK reports it in SACK blocks */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq) && !(ctl & MSK_FIN)) {
+                    _gnrc_tcp_sack_hold(tcb, in_pkt);
+                }
+#endif
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -813,7 +880,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->snd_queue_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +924,8 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->snd_queue_len > 0) {
+        _gnrc_tcp_pkt_retransmit_timeout(tcb);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -16,6 +16,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <stdbool.h>
 #include <string.h>
 #include <utlist.h>
 #include <errno.h>
@@ -25,9 +26,11 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_sack.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -49,6 +52,44 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the sequence number consumption of a segment.
+ *
+ * @param[in] ctl   Control bits of the segment.
+ * @param[in] len   Payload length of the segment.
+ *
+ * @returns   Sequence number consumption.
+ */
+static inline uint16_t _seq_con(const uint16_t ctl, const size_t len)
+{
+    return len + ((ctl & MSK_SYN) ? 1 : 0) + ((ctl & MSK_FIN) ? 1 : 0);
+}
+
+/**
+ * @brief Copies data at an offset out of an iolist.
+ *
+ * @param[out] dst      Buffer to copy the data to.
+ * @param[in]  iol      Iolist to copy from.
+ * @param[in]  offset   Offset in bytes from the start of @p iol.
+ * @param[in]  len      Number of bytes to copy.
+ */
+static void _copy_from_iolist(uint8_t *dst, const iolist_t *iol, size_t offset,
+                              size_t len)
+{
+    for (; iol != NULL && len > 0; iol = iol->iol_next) {
+        if (offset >= iol->iol_len) {
+            offset -= iol->iol_len;
+            continue;
+        }
+        size_t part = iol->iol_len - offset;
+        part = (part < len) ? part : len;
+        memcpy(dst, (uint8_t *)iol->iol_base + offset, part);
+        dst += part;
+        len -= part;
+        offset = 0;
+    }
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -145,27 +186,32 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
-int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
-                        uint16_t *seq_con, const uint16_t ctl,
-                        const uint32_t seq_num, const uint32_t ack_num,
-                        void *payload, const size_t payload_len)
+/**
+ * @brief Builds a packet around an already allocated payload.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[out]    out_pkt   Pointer to packet to build.
+ * @param[in]     pay_snp   Payload of the packet, released on error. May be NULL.
+ * @param[in]     ctl       Control bits to set in @p out_pkt.
+ * @param[in]     seq_num   Sequence number of the new packet.
+ * @param[in]     ack_num   Acknowledgment number of the new packet.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+static int _build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                  gnrc_pktsnip_t *pay_snp, const uint16_t ctl,
+                  const uint32_t seq_num, const uint32_t ack_num)
 {
     TCP_DEBUG_ENTER;
-    gnrc_pktsnip_t *pay_snp = NULL;
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
-
-    /* Add payload, if supplied */
-    if (payload != NULL && payload_len > 0) {
-        pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
-        if (pay_snp == NULL) {
-            *(out_pkt) = NULL;
-            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
-            TCP_DEBUG_LEAVE;
-            return -ENOMEM;
-        }
-    }
+#ifdef MODULE_GNRC_TCP_SACK
+    uint32_t sack_blocks[2 * GNRC_TCP_SACK_BLOCKS_MAX];
+    unsigned sack_blocks_numof = 0;
+    bool sack_perm = false;
+#endif
 
     /* Fill TCP header */
     tcp_hdr.src_port = byteorder_htons(tcb->local_port);
@@ -181,6 +227,23 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (ctl & MSK_SYN) {
         offset += 1;
     }
+#ifdef MODULE_GNRC_TCP_SACK
+    /* Offer SACK on SYN, accept it on SYN+ACK only if it was offered */
+    if ((ctl & MSK_SYN) &&
+        (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+        sack_perm = true;
+        offset += 1;
+    }
+    /* Report data received out of order */
+    else if ((ctl & MSK_ACK) && !(ctl & MSK_SYN) &&
+             (tcb->status & STATUS_SACK_PERMITTED)) {
+        sack_blocks_numof = _gnrc_tcp_sack_build_blocks(tcb, sack_blocks,
+                                                        GNRC_TCP_SACK_BLOCKS_MAX);
+        if (sack_blocks_numof > 0) {
+            offset += 1 + 2 * sack_blocks_numof;
+        }
+    }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,9 +280,32 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
+#ifdef MODULE_GNRC_TCP_SACK
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
+
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
+            }
+            if (sack_blocks_numof > 0) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_blocks_numof));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (unsigned i = 0; i < 2 * sack_blocks_numof; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack_blocks[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
+            }
+#endif
             /* NOTE: Add additional options here */
+            (void) opt_ptr;
         }
         *(out_pkt) = tcp_snp;
     }
@@ -260,19 +346,37 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
 #endif
 
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                        uint16_t *seq_con, const uint16_t ctl,
+                        const uint32_t seq_num, const uint32_t ack_num,
+                        void *payload, const size_t payload_len)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *pay_snp = NULL;
+
+    /* Add payload, if supplied */
+    if (payload != NULL && payload_len > 0) {
+        pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
+        if (pay_snp == NULL) {
+            *(out_pkt) = NULL;
+            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+    }
+
+    int ret = _build(tcb, out_pkt, pay_snp, ctl, seq_num, ack_num);
+
     /* Calculate sequence space number consumption for this packet */
     if (seq_con != NULL) {
-        *seq_con = 0;
-        if (ctl & MSK_SYN) {
-            *seq_con += 1;
-        }
-        if (ctl & MSK_FIN) {
-            *seq_con += 1;
-        }
-        *seq_con += payload_len;
+        *seq_con = _seq_con(ctl, payload_len);
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return ret;
 }
 
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
@@ -285,14 +389,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
-    }
-    else {
-        tcb->retries += 1;
     }
 
     /* Pass packet down the network stack */
@@ -375,77 +474,187 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit)
+/**
+ * @brief Sets the RTO according to the current round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _update_rto(gnrc_tcp_tcb_t *tcb)
 {
-    TCP_DEBUG_ENTER;
-    gnrc_pktsnip_t *snp = NULL;
-    uint32_t ctl = 0;
-    uint32_t len = 0;
+    /* Without measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
 
-    /* No packet received */
-    if (pkt == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: pkt == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
+/**
+ * @brief Performs boundary checks on the current RTO and (re)starts the
+ *        retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _restart_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+/**
+ * @brief Builds a packet for a segment of the send queue.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg       Segment to build the packet for.
+ * @param[out]    out_pkt   Pointer to packet to build.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+static int _build_seg(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_seg_t *seg,
+                      gnrc_pktsnip_t **out_pkt)
+{
+    gnrc_pktsnip_t *pay_snp = NULL;
+
+    /* Copy payload from the callers buffer */
+    if (seg->len > 0) {
+        pay_snp = gnrc_pktbuf_add(NULL, NULL, seg->len, GNRC_NETTYPE_UNDEF);
+        if (pay_snp == NULL) {
+            *(out_pkt) = NULL;
+            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
+            return -ENOMEM;
+        }
+        _copy_from_iolist(pay_snp->data, tcb->snd_buf, seg->seq - tcb->snd_buf_seq,
+                          seg->len);
     }
+    return _build(tcb, out_pkt, pay_snp, seg->ctl, seg->seq,
+                  (seg->ctl & MSK_ACK) ? tcb->rcv_nxt : 0);
+}
+
+/**
+ * @brief Retransmits a segment of the send queue.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in,out] seg   Segment to retransmit.
+ */
+static void _retransmit(gnrc_tcp_tcb_t *tcb, gnrc_tcp_seg_t *seg)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;
 
-    /* Extract control bits and segment length */
-    snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
-    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
-    len = _gnrc_tcp_pkt_get_pay_len(pkt);
+    seg->flags &= ~SEG_LOST;
+    seg->flags |= SEG_RETRANSMITTED;
+    if (_build_seg(tcb, seg, &out_pkt) == 0) {
+        _gnrc_tcp_pkt_send(tcb, out_pkt, 0, true);
+    }
+}
+
+int _gnrc_tcp_pkt_send_seg(gnrc_tcp_tcb_t *tcb, const uint16_t ctl, const size_t len)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *out_pkt = NULL;
+    gnrc_tcp_seg_t *seg;
 
-    /* Check if pkt contains reset or is a pure ACK, return */
-    if ((ctl & MSK_RST) || (((ctl & MSK_SYN_FIN_ACK) == MSK_ACK) && len == 0)) {
+    /* Check if send queue is full */
+    if (tcb->snd_queue_len >= CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        TCP_DEBUG_ERROR("-ENOBUFS: Send queue is full.");
         TCP_DEBUG_LEAVE;
-        return 0;
+        return -ENOBUFS;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
+    seg = &tcb->snd_queue[tcb->snd_queue_len++];
+    seg->seq = tcb->snd_nxt;
+    seg->sent = evtimer_now_msec();
+    seg->len = len;
+    seg->ctl = ctl;
+    seg->flags = 0;
+#ifdef MODULE_GNRC_TCP_CONGURE
+    _gnrc_tcp_congure_sent(tcb, seg);
+#endif
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* First segment in flight: start retransmission timer */
+    if (tcb->snd_queue_len == 1) {
+        _update_rto(tcb);
+        _restart_retransmit_timer(tcb);
+    }
+
+    /* A segment that could not be built counts as lost, the retransmission
+     * timer takes care of it */
+    if (_build_seg(tcb, seg, &out_pkt) == 0) {
+        _gnrc_tcp_pkt_send(tcb, out_pkt, _seq_con(ctl, len), false);
     }
     else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
+        tcb->snd_nxt += _seq_con(ctl, len);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_pkt_retransmit_lost(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        if (tcb->snd_queue[i].flags & SEG_LOST) {
+            _retransmit(tcb, &tcb->snd_queue[i]);
         }
     }
+    TCP_DEBUG_LEAVE;
+}
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+int _gnrc_tcp_pkt_retransmit_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_seg_t *first = NULL;
+
+    /* Send queue is empty. Nothing to retransmit */
+    if (tcb->snd_queue_len == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No segment to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
     }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+
+#ifdef MODULE_GNRC_TCP_CONGURE
+    _gnrc_tcp_congure_timeout(tcb);
+#endif
+
+    /* Double the rto (Timer Backoff) */
+    tcb->retries += 1;
+    tcb->rto *= 2;
+
+    /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+    /* New measurements must be taken the next time something is sent. */
+    if (tcb->retries >= 5) {
+        tcb->srtt = RTO_UNINITIALIZED;
+        tcb->rtt_var = RTO_UNINITIALIZED;
     }
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    /* Everything not selectively acknowledged is considered lost. Only the
+     * first segment is retransmitted right away, the others follow when the
+     * peer responds again */
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        gnrc_tcp_seg_t *seg = &tcb->snd_queue[i];
+
+        if (!(seg->flags & SEG_SACKED)) {
+            seg->flags |= SEG_LOST;
+            if (first == NULL) {
+                first = seg;
+            }
+        }
+    }
+    if (first != NULL) {
+        _retransmit(tcb, first);
+    }
+    _restart_retransmit_timer(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -453,48 +662,69 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
+    bool retransmitted = false;
 
-    /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
-        TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
+    /* Send queue is empty. Nothing to ACK there */
+    if (tcb->snd_queue_len == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No segment to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Count the segments that were acknowledged completely */
+    while (acked < tcb->snd_queue_len) {
+        gnrc_tcp_seg_t *seg = &tcb->snd_queue[acked];
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        if (!LEQ_32_BIT(seg->seq + _seq_con(seg->ctl, seg->len), ack)) {
+            break;
+        }
+        retransmitted |= (seg->flags & SEG_RETRANSMITTED);
+#ifdef MODULE_GNRC_TCP_CONGURE
+        /* Selectively acknowledged segments were reported already */
+        if (!(seg->flags & SEG_SACKED)) {
+            _gnrc_tcp_congure_acked(tcb, seg, ack);
+        }
+#endif
+        acked++;
+    }
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+    /* Measure round trip time on the latest acknowledged segment */
+    int32_t rtt = evtimer_now_msec() - tcb->snd_queue[acked - 1].sent;
+
+    /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
+    if (!retransmitted && rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
         }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        }
+        _update_rto(tcb);
+    }
+
+    /* Remove acknowledged segments from the send queue */
+    tcb->snd_queue_len -= acked;
+    memmove(tcb->snd_queue, &tcb->snd_queue[acked],
+            tcb->snd_queue_len * sizeof(tcb->snd_queue[0]));
+    tcb->retries = 0;
+
+    /* Stop the retransmission timer or restart it for the remaining segments */
+    if (tcb->snd_queue_len == 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
+    else {
+        _restart_retransmit_timer(tcb);
     }
     TCP_DEBUG_LEAVE;
     return 0;
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/sack.h
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+#include <stdbool.h>
+#include <string.h>
+#include "kernel_defines.h"
+#include "net/gnrc.h"
+#include "net/tcp.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+#include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_sack.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_GNRC_TCP_SACK)
+
+#define OOO_NUMOF   ARRAY_SIZE(((gnrc_tcp_tcb_t *)NULL)->rcv_ooo)
+
+/**
+ * @brief Extracts the sequence number of a received packet.
+ *
+ * @param[in] pkt   Received packet.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _get_seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *)snp->data)->seq_num);
+}
+
+/**
+ * @brief Removes a segment from the out-of-order queue.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pos   Position of the segment in the queue.
+ */
+static void _remove(gnrc_tcp_tcb_t *tcb, unsigned pos)
+{
+    gnrc_pktbuf_release(tcb->rcv_ooo[pos]);
+    memmove(&tcb->rcv_ooo[pos], &tcb->rcv_ooo[pos + 1],
+            (OOO_NUMOF - pos - 1) * sizeof(tcb->rcv_ooo[0]));
+    tcb->rcv_ooo[OOO_NUMOF - 1] = NULL;
+}
+
+void _gnrc_tcp_sack_mark(gnrc_tcp_tcb_t *tcb, uint32_t left, uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+        gnrc_tcp_seg_t *seg = &tcb->snd_queue[i];
+
+        if ((seg->len > 0) && LEQ_32_BIT(left, seg->seq) &&
+            LEQ_32_BIT(seg->seq + seg->len, right) &&
+            !(seg->flags & SEG_SACKED)) {
+#ifdef MODULE_GNRC_TCP_CONGURE
+            _gnrc_tcp_congure_acked(tcb, seg, right);
+#endif
+            seg->flags |= SEG_SACKED;
+            seg->flags &= ~SEG_LOST;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sack_mark_lost(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned thresh = GNRC_TCP_SACK_DUP_THRESH;
+    unsigned sacked = 0;
+
+    if (tcb->snd_queue_len <= thresh) {
+        thresh = tcb->snd_queue_len - 1;
+    }
+    if (thresh == 0) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* Walk backwards, counting the SACKed segments above the current one */
+    for (unsigned i = tcb->snd_queue_len; i-- > 0;) {
+        gnrc_tcp_seg_t *seg = &tcb->snd_queue[i];
+
+        if (seg->flags & SEG_SACKED) {
+            sacked++;
+        }
+        else if ((sacked >= thresh) && !(seg->flags & SEG_RETRANSMITTED)) {
+            seg->flags |= SEG_LOST;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sack_hold(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t seq = _get_seq(pkt);
+    gnrc_pktsnip_t *held = pkt;
+    unsigned pos = OOO_NUMOF - 1;
+
+    /* Find a free slot or a copy of this segment that is held already */
+    for (unsigned i = 0; i < OOO_NUMOF; i++) {
+        if (tcb->rcv_ooo[i] == NULL) {
+            pos = i;
+            break;
+        }
+        if (_get_seq(tcb->rcv_ooo[i]) == seq) {
+            held = tcb->rcv_ooo[i];
+            pos = i;
+            break;
+        }
+    }
+    if (held == pkt) {
+        /* Drop the oldest segment if the queue is full */
+        if (tcb->rcv_ooo[pos] != NULL) {
+            gnrc_pktbuf_release(tcb->rcv_ooo[pos]);
+        }
+        gnrc_pktbuf_hold(pkt, 1);
+    }
+
+    /* The latest segment goes first, it is reported in the first SACK block */
+    memmove(&tcb->rcv_ooo[1], &tcb->rcv_ooo[0], pos * sizeof(tcb->rcv_ooo[0]));
+    tcb->rcv_ooo[0] = held;
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sack_drain(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned i = 0;
+
+    while ((i < OOO_NUMOF) && (tcb->rcv_ooo[i] != NULL)) {
+        gnrc_pktsnip_t *pkt = tcb->rcv_ooo[i];
+        uint32_t skip = tcb->rcv_nxt - _get_seq(pkt);
+
+        /* Segment is still beyond a gap */
+        if (LSS_32_BIT(tcb->rcv_nxt, _get_seq(pkt))) {
+            i++;
+            continue;
+        }
+
+        /* Copy the part not received yet into the receive buffer */
+        for (gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+             snp && snp->type == GNRC_NETTYPE_UNDEF; snp = snp->next) {
+            if (skip >= snp->size) {
+                skip -= snp->size;
+                continue;
+            }
+            tcb->rcv_nxt += ringbuffer_add(&tcb->rcv_buf, (char *)snp->data + skip,
+                                           snp->size - skip);
+            skip = 0;
+        }
+        _remove(tcb, i);
+
+        /* rcv_nxt advanced, earlier segments may be in order now */
+        i = 0;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sack_release(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->rcv_ooo[0] != NULL) {
+        _remove(tcb, 0);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_sack_build_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                     unsigned max)
+{
+    TCP_DEBUG_ENTER;
+    unsigned numof = 0;
+
+    for (unsigned i = 0; (i < OOO_NUMOF) && (tcb->rcv_ooo[i] != NULL) &&
+         (numof < max); i++) {
+        uint32_t left = _get_seq(tcb->rcv_ooo[i]);
+        uint32_t right = left + _gnrc_tcp_pkt_get_pay_len(tcb->rcv_ooo[i]);
+        bool grown = true;
+
+        /* Extend the block over adjacent or overlapping held segments */
+        while (grown) {
+            grown = false;
+            for (unsigned j = 0; (j < OOO_NUMOF) && (tcb->rcv_ooo[j] != NULL); j++) {
+                uint32_t l = _get_seq(tcb->rcv_ooo[j]);
+                uint32_t r = l + _gnrc_tcp_pkt_get_pay_len(tcb->rcv_ooo[j]);
+
+                if (LSS_32_BIT(l, left) && LEQ_32_BIT(left, r)) {
+                    left = l;
+                    grown = true;
+                }
+                if (LSS_32_BIT(right, r) && LEQ_32_BIT(l, right)) {
+                    right = r;
+                    grown = true;
+                }
+            }
+        }
+
+        /* Skip segments covered by a block of a more recent segment */
+        bool covered = false;
+        for (unsigned k = 0; k < numof; k++) {
+            if (blocks[2 * k] == left) {
+                covered = true;
+                break;
+            }
+        }
+        if (!covered) {
+            blocks[2 * numof] = left;
+            blocks[2 * numof + 1] = right;
+            numof++;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return numof;
+}
+
+#endif /* MODULE_GNRC_TCP_SACK */
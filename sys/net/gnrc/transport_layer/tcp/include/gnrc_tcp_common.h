@@ -47,6 +47,16 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_SACK_PERMITTED (1 << 5) /**< Internal: Status bitmask SACK_PERMITTED */
+/** @} */
+
+/**
+ * @brief Flags of segments in the send queue.
+ * @{
+ */
+#define SEG_SACKED        (1 << 0) /**< Internal: Segment was selectively acknowledged */
+#define SEG_LOST          (1 << 1) /**< Internal: Segment is due for retransmission */
+#define SEG_RETRANSMITTED (1 << 2) /**< Internal: Segment was retransmitted */
 /** @} */
 
 /**
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control for GNRC TCP via CongURE.
+ *
+ * All sizes reported to @ref sys_congure are in bytes, only segments carrying
+ * payload are reported.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the congestion control of a connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Limits a send window to the congestion window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ * @param[in] wnd   Send window offered by the peer.
+ *
+ * @returns   Send window to use.
+ */
+uint32_t _gnrc_tcp_congure_wnd(const gnrc_tcp_tcb_t *tcb, uint32_t wnd);
+
+/**
+ * @brief Reports the first transmission of a segment.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     seg   Segment that was sent.
+ */
+void _gnrc_tcp_congure_sent(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_seg_t *seg);
+
+/**
+ * @brief Reports the acknowledgement of a segment, cumulative or selective.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     seg   Segment that was acknowledged.
+ * @param[in]     ack   Sequence number acknowledging @p seg.
+ */
+void _gnrc_tcp_congure_acked(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_seg_t *seg,
+                             uint32_t ack);
+
+/**
+ * @brief Reports segments marked as lost, at most once per window of data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_lost(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports an expired retransmission timer for all segments that were
+ *        not selectively acknowledged.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_timeout(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reports all segments in the send queue as discarded.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_discard(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
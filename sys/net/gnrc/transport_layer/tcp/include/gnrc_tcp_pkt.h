@@ -109,21 +109,43 @@ uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt);
 uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 
 /**
- * @brief Adds a packet to the retransmission mechanism.
+ * @brief Sends a new segment and adds it to the send queue.
  *
- * @param[in,out] tcb          TCB holding the connection information.
- * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * The segment starts at the TCBs snd_nxt. Its payload is taken from the
+ * buffer of the ongoing send call. The segment is queued for retransmission
+ * even if it could not be sent due to a full packet buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     ctl   Control bits of the segment.
+ * @param[in]     len   Payload length of the segment.
+ *
+ * @returns   Zero on success.
+ *            -ENOBUFS if the send queue is full.
+ */
+int _gnrc_tcp_pkt_send_seg(gnrc_tcp_tcb_t *tcb, const uint16_t ctl, const size_t len);
+
+/**
+ * @brief Retransmits all segments in the send queue, that are marked as lost.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_pkt_retransmit_lost(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Handles an expired retransmission timer.
+ *
+ * Backs off the retransmission timer, marks all segments that were not
+ * selectively acknowledged as lost and retransmits the first of them.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
- *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -ENODATA if the send queue is empty.
  */
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit);
+int _gnrc_tcp_pkt_retransmit_timeout(gnrc_tcp_tcb_t *tcb);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes segments from the send queue.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Selective acknowledgements (RFC 2018) for GNRC TCP.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_TCP_SACK_H
+#define GNRC_TCP_SACK_H
+
+#include <stdint.h>
+#include "net/gnrc.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of SACK blocks in a segment. This is limited by the
+ *        size of the TCP option field.
+ */
+#define GNRC_TCP_SACK_BLOCKS_MAX    (CONFIG_GNRC_TCP_SACK_OOO_QUEUE_SIZE < 4 ? \
+                                     CONFIG_GNRC_TCP_SACK_OOO_QUEUE_SIZE : 4)
+
+/**
+ * @brief Number of selectively acknowledged segments above a segment, after
+ *        which that segment is considered lost (DupThresh, RFC 6675).
+ */
+#define GNRC_TCP_SACK_DUP_THRESH    (3U)
+
+/**
+ * @brief Marks segments in the send queue as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _gnrc_tcp_sack_mark(gnrc_tcp_tcb_t *tcb, uint32_t left, uint32_t right);
+
+/**
+ * @brief Marks segments in the send queue as lost, if enough segments after
+ *        them were selectively acknowledged.
+ *
+ * If less than GNRC_TCP_SACK_DUP_THRESH + 1 segments are in flight, the
+ * threshold is lowered accordingly (Early Retransmit, RFC 5827).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_sack_mark_lost(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Holds back a segment that was received out of order.
+ *
+ * If the queue of out-of-order segments is full, the oldest one is dropped.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Received segment.
+ */
+void _gnrc_tcp_sack_hold(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Moves held back segments, that became in order, to the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_sack_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Releases all held back segments.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_sack_release(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Builds SACK blocks from the held back segments.
+ *
+ * The first block contains the most recently received segment.
+ *
+ * @param[in]  tcb      TCB holding the connection information.
+ * @param[out] blocks   Left and right edges of the blocks.
+ * @param[in]  max      Maximum number of blocks.
+ *
+ * @returns   Number of blocks written to @p blocks.
+ */
+unsigned _gnrc_tcp_sack_build_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                     unsigned max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_SACK_H */
+/** @} */
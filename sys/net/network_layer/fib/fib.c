@@ -32,6 +32,10 @@
 #include "xtimer.h"
 #include "timex.h"
 #include "utlist.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_FIB_INDEX)
+#include "hashes.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -68,6 +72,205 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#if IS_USED(MODULE_FIB_INDEX)
+#define FIB_INDEX_MASK      ((1U << CONFIG_FIB_INDEX_SIZE_EXP) - 1)
+
+/**
+ * @brief checks if the given entry may match other destinations than its own,
+ *        i.e. if it is a prefix or a default route
+ */
+static bool fib_index_is_pfx(const fib_entry_t *entry)
+{
+    if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        return true;
+    }
+    for (size_t i = 0; i < entry->global->address_size; i++) {
+        if (entry->global->address[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief forgets all destinations in the destination cache of the table
+ */
+static inline void fib_dc_flush(fib_table_t *table)
+{
+    memset(table->dc, 0, sizeof(table->dc));
+}
+
+/**
+ * @brief notes the lifetime of an entry, so the table gets swept once it
+ *        expired
+ */
+static inline void fib_index_upd(fib_table_t *table, const fib_entry_t *entry)
+{
+    if (entry->lifetime < table->index_expiry) {
+        table->index_expiry = entry->lifetime;
+    }
+}
+
+/**
+ * @brief adds a newly created entry to the index of the table
+ */
+static void fib_index_add(fib_table_t *table, fib_entry_t *entry)
+{
+    uint32_t hash = djb2_hash(entry->global->address, entry->global->address_size);
+    fib_entry_t **ptr;
+
+    LL_PREPEND2(table->index[hash & FIB_INDEX_MASK], entry, index_next);
+    if (fib_index_is_pfx(entry)) {
+        /* keep table order so the search picks the same entry as a full scan */
+        for (ptr = &table->index_pfx; (*ptr != NULL) && (*ptr < entry);
+             ptr = &(*ptr)->index_pfx_next) {}
+        entry->index_pfx_next = *ptr;
+        *ptr = entry;
+    }
+    fib_index_upd(table, entry);
+    fib_dc_flush(table);
+}
+
+/**
+ * @brief removes an entry from the index of the table, if it is in there
+ */
+static void fib_index_del(fib_table_t *table, fib_entry_t *entry)
+{
+    if (entry->global != NULL) {
+        uint32_t hash = djb2_hash(entry->global->address, entry->global->address_size);
+
+        LL_DELETE2(table->index[hash & FIB_INDEX_MASK], entry, index_next);
+        if (fib_index_is_pfx(entry)) {
+            LL_DELETE2(table->index_pfx, entry, index_pfx_next);
+        }
+    }
+    entry->index_next = NULL;
+    entry->index_pfx_next = NULL;
+    fib_dc_flush(table);
+}
+
+/**
+ * @brief empties the index of the table
+ */
+static void fib_index_init(fib_table_t *table)
+{
+    memset(table->index, 0, sizeof(table->index));
+    table->index_pfx = NULL;
+    table->sr_index_valid = false;
+    table->index_expiry = FIB_LIFETIME_NO_EXPIRE;
+    fib_dc_flush(table);
+}
+
+/**
+ * @brief removes all expired entries of the table, if any lifetime passed
+ */
+static void fib_index_sweep(fib_table_t *table, uint64_t now)
+{
+    if (table->index_expiry >= now) {
+        return;
+    }
+
+    table->index_expiry = FIB_LIFETIME_NO_EXPIRE;
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->lifetime == 0) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+        if (entry->lifetime < now) {
+            fib_remove(table, entry);
+        }
+        else {
+            fib_index_upd(table, entry);
+        }
+    }
+}
+
+/**
+ * @brief fib_find_entry() using the index of the table
+ *
+ * Gives the same results as searching the whole table: an exact match is
+ * looked up in the hash buckets, then the best prefix or default route is
+ * searched among the prefix list the same way as in a full search. Expired
+ * entries are removed by sweeping the whole table, but only once the earliest
+ * lifetime in the table passed.
+ */
+static int fib_index_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                                fib_entry_t **entry_arr, size_t *entry_arr_size)
+{
+    uint64_t now = xtimer_now_usec64();
+    uint32_t hash = djb2_hash(dst, dst_size);
+    fib_dc_entry_t *dc = &table->dc[hash % CONFIG_FIB_DC_NUMOF];
+    fib_entry_t *entry;
+    size_t prefix_size = 0;
+    int ret = -EHOSTUNREACH;
+
+    *entry_arr_size = 0;
+    fib_index_sweep(table, now);
+    if ((dc->entry != NULL) && (dc->dst_size == dst_size) &&
+        (memcmp(dc->dst, dst, dst_size) == 0)) {
+        DEBUG("[fib_find_entry] destination cache hit\n");
+        entry_arr[0] = dc->entry;
+        *entry_arr_size = 1;
+        return dc->exact;
+    }
+
+    LL_FOREACH2(table->index[hash & FIB_INDEX_MASK], entry, index_next) {
+        if ((entry->global->address_size == dst_size) &&
+            (memcmp(entry->global->address, dst, dst_size) == 0)) {
+            entry_arr[0] = entry;
+            *entry_arr_size = 1;
+            ret = 1;
+            break;
+        }
+    }
+
+    if (ret < 0) {
+        LL_FOREACH2(table->index_pfx, entry, index_pfx_next) {
+            size_t match_size = dst_size << 3;
+            int ret_comp = universal_address_compare(entry->global, dst, &match_size);
+
+            if ((ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) &&
+                (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)) {
+                uint32_t global_prefix_len = (entry->global_flags
+                                              & FIB_FLAG_NET_PREFIX_MASK)
+                                             >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+                if ((match_size >= global_prefix_len) &&
+                    ((prefix_size == 0) || (match_size > prefix_size))) {
+                    entry_arr[0] = entry;
+                    *entry_arr_size = 1;
+                    prefix_size = match_size;
+                    ret = 0;
+                }
+            }
+            else if ((ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) &&
+                     (prefix_size == 0)) {
+                entry_arr[0] = entry;
+                *entry_arr_size = 1;
+                ret = 0;
+            }
+        }
+    }
+
+    if ((ret >= 0) && (dst_size <= sizeof(dc->dst))) {
+        dc->entry = entry_arr[0];
+        memcpy(dc->dst, dst, dst_size);
+        dc->dst_size = dst_size;
+        dc->exact = ret;
+    }
+
+    return ret;
+}
+#else
+#define fib_index_add(table, entry)     (void)table
+#define fib_index_del(table, entry)     (void)table
+#define fib_index_init(table)           (void)table
+#define fib_index_upd(table, entry)     (void)table
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -84,6 +287,9 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#if IS_USED(MODULE_FIB_INDEX)
+    return fib_index_find_entry(table, dst, dst_size, entry_arr, entry_arr_size);
+#else
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -191,6 +397,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
     *entry_arr_size = count;
     return ret;
+#endif
 }
 
 /**
@@ -272,8 +479,17 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+                fib_index_add(table, &table->data.entries[i]);
                 return 0;
             }
+#if IS_USED(MODULE_FIB_INDEX)
+            /* the index search never comes across unused entries to remove
+             * them, so release the destination right away */
+            if (table->data.entries[i].global != NULL) {
+                universal_address_rem(table->data.entries[i].global);
+                table->data.entries[i].global = NULL;
+            }
+#endif
         }
     }
 
@@ -283,12 +499,15 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry is in
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+    fib_index_del(table, entry);
+
     if (entry->global != NULL) {
         universal_address_rem(entry->global);
     }
@@ -409,6 +628,7 @@ int fib_add_entry(fib_table_t *table,
     if (ret == 1) {
         /* we must take the according entry and update the values */
         ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        fib_index_upd(table, entry[0]);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -439,6 +659,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
         ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        fib_index_upd(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -462,7 +683,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +703,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -604,6 +825,7 @@ void fib_init(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+    fib_index_init(table);
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -629,6 +851,7 @@ void fib_deinit(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+    fib_index_init(table);
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -673,6 +896,87 @@ int fib_get_num_used_entries(fib_table_t *table)
 }
 
 /* source route handling */
+#if IS_USED(MODULE_FIB_INDEX)
+/**
+ * @brief marks the index of a source route table as outdated, so the next
+ *        search rebuilds it
+ */
+static inline void fib_sr_index_invalidate(fib_table_t *table)
+{
+    table->sr_index_valid = false;
+}
+
+/**
+ * @brief builds the index of a source route table, if a source route changed
+ *        since it was built last
+ *
+ * The hops in each hash bucket are kept in table and path order, so a search
+ * picks the same hop as a full scan.
+ */
+static void fib_sr_index_build(fib_table_t *table)
+{
+    fib_sr_entry_t **tail[ARRAY_SIZE(table->sr_index)];
+
+    if (table->sr_index_valid) {
+        return;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(table->sr_index); ++i) {
+        table->sr_index[i] = NULL;
+        tail[i] = &table->sr_index[i];
+    }
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_sr_t *sr = &table->data.source_routes->headers[i];
+        fib_sr_entry_t *elt = NULL;
+
+        if (sr->sr_lifetime == 0) {
+            continue;
+        }
+        LL_FOREACH(sr->sr_path, elt) {
+            uint32_t hash = djb2_hash(elt->address->address, elt->address->address_size);
+
+            elt->index_sr = sr;
+            elt->index_next = NULL;
+            *tail[hash & FIB_INDEX_MASK] = elt;
+            tail[hash & FIB_INDEX_MASK] = &elt->index_next;
+        }
+    }
+    table->sr_index_valid = true;
+}
+
+/**
+ * @brief returns the next hop with the given address in the index of a source
+ *        route table, starting after @p elt or at the first one if it is NULL
+ *
+ * Hops of source routes removed since the index was built are skipped. The
+ * lifetime of the returned source route may have passed though, the caller has
+ * to check it.
+ */
+static fib_sr_entry_t *fib_sr_index_next(fib_table_t *table, fib_sr_entry_t *elt,
+                                         uint8_t *addr, size_t addr_size)
+{
+    if (elt == NULL) {
+        elt = table->sr_index[djb2_hash(addr, addr_size) & FIB_INDEX_MASK];
+    }
+    else {
+        elt = elt->index_next;
+    }
+
+    for (; elt != NULL; elt = elt->index_next) {
+        size_t addr_size_match = addr_size << 3;
+        if ((elt->index_sr->sr_lifetime != 0)
+            && (UNIVERSAL_ADDRESS_EQUAL == universal_address_compare(elt->address, addr,
+                                                                     &addr_size_match))) {
+            return elt;
+        }
+    }
+    return NULL;
+}
+#else
+#define fib_sr_index_invalidate(table)  (void)table
+#endif
+
 int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_id,
                   uint32_t sr_flags, uint32_t sr_lifetime)
 {
@@ -696,6 +1000,7 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
                 table->data.source_routes->headers[i].sr_lifetime = FIB_LIFETIME_NO_EXPIRE;
             }
             *fib_sr = &table->data.source_routes->headers[i];
+            fib_sr_index_invalidate(table);
             mutex_unlock(&(table->mtx_access));
             return 0;
         }
@@ -860,6 +1165,7 @@ int fib_sr_delete(fib_table_t *table, fib_sr_t *fib_sr)
     }
 
     fib_sr->sr_lifetime = 0;
+    fib_sr_index_invalidate(table);
 
     if (fib_sr->sr_path != NULL) {
         fib_sr_entry_t *elt = NULL, *tmp = NULL;
@@ -929,19 +1235,25 @@ int fib_sr_search(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, size_t ad
     }
 
     fib_sr_entry_t *elt = NULL;
+#if IS_USED(MODULE_FIB_INDEX)
+    fib_sr_index_build(table);
+    while (((elt = fib_sr_index_next(table, elt, addr, addr_size)) != NULL)
+           && (elt->index_sr != fib_sr)) {}
+#else
     LL_FOREACH(fib_sr->sr_path, elt) {
         size_t addr_size_match = addr_size << 3;
         if (UNIVERSAL_ADDRESS_EQUAL == universal_address_compare(elt->address, addr,
                                                                  &addr_size_match)) {
-
-            /* temporary workaround to calm compiler */
-            (void)sr_path_entry;
-
-            *sr_path_entry = elt;
-            mutex_unlock(&(table->mtx_access));
-            return 0;
+            break;
         }
     }
+#endif
+
+    if (elt != NULL) {
+        *sr_path_entry = elt;
+        mutex_unlock(&(table->mtx_access));
+        return 0;
+    }
 
     mutex_unlock(&(table->mtx_access));
     return -EHOSTUNREACH;
@@ -976,6 +1288,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
     int ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
 
     if (ret == 0) {
+        fib_sr_index_invalidate(table);
         fib_sr_entry_t *tmp = fib_sr->sr_dest;
         if (tmp != NULL) {
             /* we append the new entry behind the former destination */
@@ -1028,6 +1341,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         fib_sr_entry_t *new_entry[1];
         ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
         if (ret == 0) {
+            fib_sr_index_invalidate(table);
             fib_sr_entry_t *remaining = sr_path_entry->next;
             sr_path_entry->next = new_entry[0];
             if (keep_remaining_route) {
@@ -1071,6 +1385,7 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
 
         if (UNIVERSAL_ADDRESS_EQUAL == universal_address_compare(elt->address, addr,
                                                                  &addr_size_match)) {
+            fib_sr_index_invalidate(table);
             universal_address_rem(elt->address);
             if (keep_remaining_route) {
                 tmp->next = elt->next;
@@ -1134,6 +1449,7 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
     }
 
     if (elt_repl != NULL) {
+        fib_sr_index_invalidate(table);
         universal_address_rem(elt_repl->address);
         universal_address_container_t *add = universal_address_add(addr_new, addr_new_size);
 
@@ -1184,6 +1500,47 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
     return -ENOENT;
 }
 
+/**
+ * @brief helper function to search the first hop on any source route with the
+ *        given address, in table order
+ *
+ * @param[in] table the fib table to search in
+ * @param[in] dst pointer to the address bytes
+ * @param[in] dst_size the size in bytes of the address type
+ * @param[out] fib_sr the source route the hop is on
+ *
+ * @return pointer to the hop on success
+ *         NULL otherwise
+*/
+static fib_sr_entry_t *_fib_sr_search_hop(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                                          fib_sr_t **fib_sr)
+{
+    fib_sr_entry_t *elt = NULL;
+
+#if IS_USED(MODULE_FIB_INDEX)
+    fib_sr_index_build(table);
+    elt = fib_sr_index_next(table, NULL, dst, dst_size);
+    if (elt != NULL) {
+        *fib_sr = elt->index_sr;
+        return elt;
+    }
+#else
+    for (size_t i = 0; i < table->size; ++i) {
+        if (table->data.source_routes->headers[i].sr_lifetime != 0) {
+            LL_FOREACH(table->data.source_routes->headers[i].sr_path, elt) {
+                size_t addr_size_match = dst_size << 3;
+                if (UNIVERSAL_ADDRESS_EQUAL == universal_address_compare(elt->address, dst,
+                                                                         &addr_size_match)) {
+                    *fib_sr = &table->data.source_routes->headers[i];
+                    return elt;
+                }
+            }
+        }
+    }
+#endif
+    return NULL;
+}
+
 /**
  * @brief helper function to search a partial path to a given destination,
  *         and iff successful to create a new source route
@@ -1200,101 +1557,88 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
 static fib_sr_t* _fib_create_sr_from_partial(fib_table_t *table, uint8_t *dst, size_t dst_size,
                                              int check_free_entry, int *error) {
     fib_sr_t* hit = NULL;
+    fib_sr_t *tmp = NULL;
+    fib_sr_entry_t *elt = _fib_sr_search_hop(table, dst, dst_size, &tmp);
 
-    for (size_t i = 0; i < table->size; ++i) {
-        if (table->data.source_routes->headers[i].sr_lifetime != 0) {
+    if (elt == NULL) {
+        return NULL;
+    }
 
-            fib_sr_entry_t *elt = NULL;
-            LL_FOREACH(table->data.source_routes->headers[i].sr_path, elt) {
-                size_t addr_size_match = dst_size << 3;
-                if (UNIVERSAL_ADDRESS_EQUAL == universal_address_compare(elt->address, dst,
-                                                                         &addr_size_match)) {
-                    /* we create a new sr */
-                    if (check_free_entry == -1) {
-                        /* we have no room to create a new sr
-                         * so we just return and NOT tell the RPs to find a route
-                         * since we cannot save it
+    /* we create a new sr */
+    if (check_free_entry == -1) {
+        /* we have no room to create a new sr
+         * so we just return and NOT tell the RPs to find a route
+         * since we cannot save it
+         */
+        *error = -ENOBUFS;
+        return NULL;
+    }
+
+    /* we check if there is a free place for the new sr */
+    fib_sr_t *new_sr = NULL;
+    for (size_t j = check_free_entry; j < table->size; ++j) {
+        if (table->data.source_routes->headers[j].sr_lifetime != 0) {
+            /* not this one, maybe the next one */
+            continue;
+        }
+        else {
+            /* there it is, so we copy the header */
+            new_sr = &table->data.source_routes->headers[j];
+            new_sr->sr_iface_id = tmp->sr_iface_id;
+            new_sr->sr_flags = tmp->sr_flags;
+            new_sr->sr_lifetime = tmp->sr_lifetime;
+            new_sr->sr_path = NULL;
+            fib_sr_index_invalidate(table);
+
+            /* and the path until the searched destination */
+            fib_sr_entry_t *elt_iter = NULL, *elt_add = NULL;
+
+            LL_FOREACH(tmp->sr_path, elt_iter) {
+                fib_sr_entry_t *new_entry;
+
+                if (fib_sr_new_entry(table, elt_iter->address->address,
+                                     elt_iter->address->address_size,
+                                     &new_entry) != 0) {
+                    /* we could not create a new entry
+                     * so we return to clean up the partial route
+                     */
+                    *error = -ENOBUFS;
+                    return new_sr;
+                }
+
+                if (new_sr->sr_path == NULL) {
+                    new_sr->sr_path = new_entry;
+                    elt_add = new_sr->sr_path;
+                }
+                else {
+                    elt_add->next = new_entry;
+                    elt_add = elt_add->next;
+                }
+
+                if (elt_iter == elt) {
+                    /* we copied until the destination */
+                    new_sr->sr_dest = new_entry;
+                    hit = new_sr;
+
+                    /* tell the RPs that a new sr has been created
+                     * the size and the flags parameters are ignored
+                     */
+                    if (fib_signal_rp(table,
+                                      FIB_MSG_RP_SIGNAL_SOURCE_ROUTE_CREATED,
+                                      (uint8_t *)new_sr, 0, 0) != 0) {
+                        /* if no RP can handle the source route
+                         * then the host is not directly reachable
                          */
-                        *error = -ENOBUFS;
-                        return NULL;
+                        *error = -EHOSTUNREACH;
                     }
-                    else {
-                        /* we check if there is a free place for the new sr */
-                        fib_sr_t *new_sr = NULL;
-                        for (size_t j = check_free_entry; j < table->size; ++j) {
-                            if (table->data.source_routes->headers[j].sr_lifetime != 0) {
-                                /* not this one, maybe the next one */
-                                continue;
-                            }
-                            else {
-                                /* there it is, so we copy the header */
-                                new_sr = &table->data.source_routes->headers[j];
-                                fib_sr_t *tmp = &table->data.source_routes->headers[i];
-                                new_sr->sr_iface_id = tmp->sr_iface_id;
-                                new_sr->sr_flags = tmp->sr_flags;
-                                new_sr->sr_lifetime = tmp->sr_lifetime;
-                                new_sr->sr_path = NULL;
-
-                                /* and the path until the searched destination */
-                                fib_sr_entry_t *elt_iter = NULL, *elt_add = NULL;
-
-                                LL_FOREACH(tmp->sr_path, elt_iter) {
-                                    fib_sr_entry_t *new_entry;
-
-                                    if (fib_sr_new_entry(table, elt_iter->address->address,
-                                                         elt_iter->address->address_size,
-                                                         &new_entry) != 0) {
-                                        /* we could not create a new entry
-                                         * so we return to clean up the partial route
-                                         */
-                                        *error = -ENOBUFS;
-                                        return new_sr;
-                                    }
-
-                                    if (new_sr->sr_path == NULL) {
-                                        new_sr->sr_path = new_entry;
-                                        elt_add = new_sr->sr_path;
-                                    }
-                                    else {
-                                        elt_add->next = new_entry;
-                                        elt_add = elt_add->next;
-                                    }
-
-                                    if (elt_iter == elt) {
-                                        /* we copied until the destination */
-                                        new_sr->sr_dest = new_entry;
-                                        hit = new_sr;
-
-                                        /* tell the RPs that a new sr has been created
-                                         * the size and the flags parameters are ignored
-                                         */
-                                        if (fib_signal_rp(table,
-                                                          FIB_MSG_RP_SIGNAL_SOURCE_ROUTE_CREATED,
-                                                          (uint8_t *)new_sr, 0, 0) != 0) {
-                                            /* if no RP can handle the source route
-                                             * then the host is not directly reachable
-                                             */
-                                            *error = -EHOSTUNREACH;
-                                        }
-
-                                        /* break from iterating for copy */
-                                        break;
-                                    }
-                                }
-                            }
-                        }
 
-                        /* break from iterating the found path */
-                        break;
-                    }
+                    /* break from iterating for copy */
+                    break;
                 }
             }
-            if (hit != NULL) {
-                /* break iterating all sr since we have a path now */
-                break;
-            }
         }
     }
+
     return hit;
 }
 
@@ -1316,6 +1660,56 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     int check_free_entry = -1;
 
     bool skip = (fib_sr != NULL) && (*fib_sr != NULL)?true:false;
+#if IS_USED(MODULE_FIB_INDEX)
+    /* Case 1 - check if we know a direct route, among the hops indexed for dst */
+    fib_sr_t *first = table->data.source_routes->headers;
+    fib_sr_entry_t *hop = NULL;
+
+    if (skip) {
+        /* we skip all entries upon the consecutive one to start search */
+        first += table->size;
+        if ((fib_is_sr_in_table(table, *fib_sr) == 0)
+            && (fib_sr_check_lifetime(*fib_sr) == 0)) {
+            first = *fib_sr + 1;
+        }
+    }
+
+    fib_sr_index_build(table);
+    while ((hop = fib_sr_index_next(table, hop, dst, dst_size)) != NULL) {
+        fib_sr_t *sr = hop->index_sr;
+
+        if ((sr < first) || (hop != sr->sr_dest)
+            || (fib_sr_check_lifetime(sr) == -ENOENT)) {
+            continue;
+        }
+
+        if (*sr_flags == sr->sr_flags) {
+            /* found a perfect matching sr, no need to search further */
+            hit = sr;
+            tmp_hit = NULL;
+            break;
+        }
+        else {
+            /* found a sr to the destination but with different flags,
+             * maybe we find a better one.
+             */
+            tmp_hit = sr;
+        }
+    }
+
+    /* expire the sr up to the hit like a full search, and remember the first
+     * free position for Case 2 */
+    size_t end = table->size;
+    if (hit != NULL) {
+        end = (size_t)(hit - table->data.source_routes->headers) + 1;
+    }
+    for (size_t i = 0; i < end; ++i) {
+        if ((fib_sr_check_lifetime(&table->data.source_routes->headers[i]) == -ENOENT)
+            && (check_free_entry == -1)) {
+            check_free_entry = i;
+        }
+    }
+#else
     /* Case 1 - check if we know a direct route */
     for (size_t i = 0; i < table->size; ++i) {
 
@@ -1356,6 +1750,7 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
             }
         }
     }
+#endif
 
     if (hit == NULL) {
         /* we didn't find a perfect sr, but one with distinct flags */
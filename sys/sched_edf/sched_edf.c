@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduler implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static sched_edf_t *_tasks[SCHED_EDF_NUMOF];
+
+static inline bool _before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static void _release_cb(void *arg)
+{
+    sched_edf_t *edf = arg;
+    thread_t *active_thread = thread_get_active();
+
+    DEBUG("sched_edf: release job of %" PRIkernel_pid "\n", edf->thread->pid);
+    thread_flags_set(edf->thread, THREAD_FLAG_SCHED_EDF);
+    /* thread_flags_set() does not preempt threads of the same priority, so
+     * let the scheduler decide which job has the earlier deadline */
+    if (active_thread && (active_thread != edf->thread) &&
+        (active_thread->priority == SCHED_EDF_PRIO)) {
+        thread_yield_higher();
+    }
+}
+
+void sched_runq_select_callback(uint8_t prio)
+{
+    sched_edf_t *first = NULL;
+
+    if ((prio != SCHED_EDF_PRIO) || !sched_runq_more_than_one(prio)) {
+        return;
+    }
+    for (unsigned i = 0; i < SCHED_EDF_NUMOF; i++) {
+        sched_edf_t *edf = _tasks[i];
+
+        if ((edf == NULL) || (edf->thread->priority != prio) ||
+            (edf->thread->status < STATUS_ON_RUNQUEUE)) {
+            continue;
+        }
+        if ((first == NULL) || _before(edf->abs_deadline, first->abs_deadline)) {
+            first = edf;
+        }
+    }
+    if (first != NULL) {
+        clist_node_t *runq = &sched_runqueues[prio];
+        clist_node_t *node = &first->thread->rq_entry;
+
+        if (runq->next->next != node) {
+            clist_remove(runq, node);
+            clist_lpush(runq, node);
+        }
+    }
+}
+
+int sched_edf_register(sched_edf_t *edf, uint32_t period, uint32_t deadline)
+{
+    unsigned state;
+    unsigned i;
+
+    assert((period > 0) && (deadline > 0) && (deadline <= period));
+    state = irq_disable();
+    for (i = 0; i < SCHED_EDF_NUMOF; i++) {
+        if (_tasks[i] == NULL) {
+            break;
+        }
+    }
+    if (i == SCHED_EDF_NUMOF) {
+        irq_restore(state);
+        return -ENOMEM;
+    }
+    edf->timer.callback = _release_cb;
+    edf->timer.arg = edf;
+    edf->thread = thread_get_active();
+    edf->period = period;
+    edf->deadline = deadline;
+    edf->release = ztimer_now(SCHED_EDF_TIMERBASE);
+    edf->abs_deadline = edf->release + deadline;
+    edf->jobs = 0;
+    edf->misses = 0;
+    _tasks[i] = edf;
+    irq_restore(state);
+    sched_change_priority(edf->thread, SCHED_EDF_PRIO);
+    /* the first job might not have the earliest deadline in the band */
+    thread_yield_higher();
+    return 0;
+}
+
+void sched_edf_wait(sched_edf_t *edf)
+{
+    uint32_t now = ztimer_now(SCHED_EDF_TIMERBASE);
+    unsigned state;
+    int32_t ahead;
+
+    assert(edf->thread == thread_get_active());
+    state = irq_disable();
+    edf->jobs++;
+    if (_before(edf->abs_deadline, now)) {
+        DEBUG("sched_edf: %" PRIkernel_pid " missed deadline by %" PRIu32 "\n",
+              edf->thread->pid, now - edf->abs_deadline);
+        edf->misses++;
+#ifdef MODULE_SCHEDSTATISTICS
+        sched_pidlist[edf->thread->pid].deadline_misses++;
+#endif
+    }
+    edf->release += edf->period;
+    edf->abs_deadline = edf->release + edf->deadline;
+    irq_restore(state);
+
+    ahead = (int32_t)(edf->release - now);
+    if (ahead > 0) {
+        ztimer_set(SCHED_EDF_TIMERBASE, &edf->timer, ahead);
+        thread_flags_wait_any(THREAD_FLAG_SCHED_EDF);
+    }
+    else {
+        /* next job is already due, but another one might be more urgent */
+        thread_yield_higher();
+    }
+}
+
+void sched_edf_unregister(sched_edf_t *edf)
+{
+    unsigned state = irq_disable();
+
+    ztimer_remove(SCHED_EDF_TIMERBASE, &edf->timer);
+    for (unsigned i = 0; i < SCHED_EDF_NUMOF; i++) {
+        if (_tasks[i] == edf) {
+            _tasks[i] = NULL;
+            break;
+        }
+    }
+    irq_restore(state);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_profiler
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_profiler.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+#if IS_USED(MODULE_SCHED_PROFILER_CBOR)
+#include "nanocbor/nanocbor.h"
+#endif
+
+#define SUB_BITS        CONFIG_SCHED_PROFILER_HIST_SUB_BITS
+#define SUB_MASK        ((1U << SUB_BITS) - 1)
+
+#define READY           (0x1)
+#define READY_FROM_ISR  (0x2)
+
+sched_profiler_t sched_profiler[KERNEL_PID_LAST + 1];
+
+/* threads get ready before ZTIMER_USEC is initialized, e.g. idle and main in
+ * kernel_init() */
+static bool _running;
+
+static unsigned _bucket(uint32_t us)
+{
+    unsigned msb, idx;
+
+    if (us < (1U << SUB_BITS)) {
+        return us;
+    }
+    /* bitarithm_msb() takes an unsigned, which might be 16 bit wide */
+    msb = ((us >> 16) != 0) ? bitarithm_msb(us >> 16) + 16
+                            : bitarithm_msb(us);
+    idx = ((msb - SUB_BITS + 1) << SUB_BITS) +
+          ((us >> (msb - SUB_BITS)) & SUB_MASK);
+    return (idx < CONFIG_SCHED_PROFILER_HIST_NUMOF)
+         ? idx : (CONFIG_SCHED_PROFILER_HIST_NUMOF - 1);
+}
+
+static void _hist_add(sched_profiler_hist_t *hist, uint32_t us)
+{
+    uint16_t *bucket = &hist->buckets[_bucket(us)];
+
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+uint32_t sched_profiler_bucket_min(unsigned idx)
+{
+    unsigned msb;
+
+    if (idx < (1U << SUB_BITS)) {
+        return idx;
+    }
+    msb = (idx >> SUB_BITS) + SUB_BITS - 1;
+    return ((uint32_t)((1U << SUB_BITS) | (idx & SUB_MASK))) <<
+           (msb - SUB_BITS);
+}
+
+void sched_ready_callback(thread_t *thread)
+{
+    sched_profiler_t *prof = &sched_profiler[thread->pid];
+
+    if (!_running) {
+        return;
+    }
+    prof->ready_since = ztimer_now(ZTIMER_USEC);
+    prof->ready = irq_is_in() ? (READY | READY_FROM_ISR) : READY;
+}
+
+static void _sched_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
+{
+    uint32_t now;
+
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_statistics_cb(active_thread, next_thread);
+#endif
+    if (!_running) {
+        return;
+    }
+    now = ztimer_now(ZTIMER_USEC);
+    if (active_thread != KERNEL_PID_UNDEF) {
+        sched_profiler_t *prof = &sched_profiler[active_thread];
+        thread_t *thread = thread_get_unchecked(active_thread);
+        uint32_t slice = now - prof->laststart;
+
+        if (slice > prof->max_slice_us) {
+            prof->max_slice_us = slice;
+        }
+        /* still on the runqueue: the thread got preempted or yielded */
+        if (thread->status >= STATUS_ON_RUNQUEUE) {
+            prof->preemptions++;
+            prof->ready_since = now;
+            prof->ready = READY;
+        }
+    }
+    if (next_thread != KERNEL_PID_UNDEF) {
+        sched_profiler_t *prof = &sched_profiler[next_thread];
+
+        prof->laststart = now;
+        prof->switches++;
+        if (prof->ready & READY) {
+            uint32_t latency = now - prof->ready_since;
+
+            _hist_add(&prof->latency, latency);
+            if (prof->ready & READY_FROM_ISR) {
+                _hist_add(&prof->irq_latency, latency);
+            }
+            prof->ready = 0;
+        }
+    }
+}
+
+void sched_profiler_reset(void)
+{
+    unsigned state = irq_disable();
+    kernel_pid_t active = thread_getpid();
+
+    memset(sched_profiler, 0, sizeof(sched_profiler));
+    if (active != KERNEL_PID_UNDEF) {
+        sched_profiler[active].laststart = ztimer_now(ZTIMER_USEC);
+    }
+    irq_restore(state);
+}
+
+void sched_profiler_init(void)
+{
+    /* the calling thread was scheduled before the callback got registered */
+    sched_profiler_reset();
+    _running = true;
+    sched_register_cb(_sched_cb);
+}
+
+static void _print_hist(const char *name, const sched_profiler_hist_t *hist)
+{
+    printf("    %s [us]:", name);
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_NUMOF; i++) {
+        if (hist->buckets[i]) {
+            printf(" %s%" PRIu32 ":%u",
+                   (i == (CONFIG_SCHED_PROFILER_HIST_NUMOF - 1)) ? ">=" : "",
+                   sched_profiler_bucket_min(i), hist->buckets[i]);
+        }
+    }
+    puts("");
+}
+
+void sched_profiler_print(void)
+{
+    printf("\tpid | %-21s| switches | preempted | max slice [us]\n", "name");
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        sched_profiler_t prof;
+        thread_t *thread = thread_get(pid);
+        unsigned state;
+
+        if (thread == NULL) {
+            continue;
+        }
+        state = irq_disable();
+        prof = sched_profiler[pid];
+        irq_restore(state);
+        if (prof.switches == 0) {
+            continue;
+        }
+        printf("\t%3" PRIkernel_pid " | %-20s | %8" PRIu32 " | %9" PRIu32
+               " | %" PRIu32 "\n", pid,
+               thread_get_name(thread) ? thread_get_name(thread) : "-",
+               prof.switches, prof.preemptions, prof.max_slice_us);
+        _print_hist("latency", &prof.latency);
+        _print_hist("irq latency", &prof.irq_latency);
+    }
+}
+
+#if IS_USED(MODULE_SCHED_PROFILER_CBOR)
+static void _fmt_hist(nanocbor_encoder_t *enc, const sched_profiler_hist_t *hist)
+{
+    nanocbor_fmt_array(enc, CONFIG_SCHED_PROFILER_HIST_NUMOF);
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_NUMOF; i++) {
+        nanocbor_fmt_uint(enc, hist->buckets[i]);
+    }
+}
+
+ssize_t sched_profiler_to_cbor(uint8_t *buf, size_t len)
+{
+    nanocbor_encoder_t enc;
+    size_t numof = 0;
+    size_t res;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (sched_profiler[pid].switches) {
+            numof++;
+        }
+    }
+    nanocbor_encoder_init(&enc, buf, len);
+    nanocbor_fmt_array(&enc, numof + 1);
+    nanocbor_fmt_uint(&enc, SUB_BITS);
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        sched_profiler_t prof;
+        unsigned state = irq_disable();
+
+        prof = sched_profiler[pid];
+        irq_restore(state);
+        if (prof.switches == 0) {
+            continue;
+        }
+        if (numof-- == 0) {
+            /* a thread got scheduled for the first time in between, stick to
+             * the announced array length */
+            break;
+        }
+        nanocbor_fmt_array(&enc, 6);
+        nanocbor_fmt_uint(&enc, pid);
+        nanocbor_fmt_uint(&enc, prof.switches);
+        nanocbor_fmt_uint(&enc, prof.preemptions);
+        nanocbor_fmt_uint(&enc, prof.max_slice_us);
+        _fmt_hist(&enc, &prof.latency);
+        _fmt_hist(&enc, &prof.irq_latency);
+    }
+    res = nanocbor_encoded_len(&enc);
+    if ((buf != NULL) && (res > len)) {
+        return -ENOBUFS;
+    }
+    return res;
+}
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the scheduler profiler
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched_profiler.h"
+
+int _sched_profiler_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        sched_profiler_print();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        sched_profiler_reset();
+    }
+    else {
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
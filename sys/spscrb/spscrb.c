@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_spscrb
+ * @{
+ *
+ * @file
+ * @brief       Single-producer/single-consumer ringbuffer implementation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "spscrb.h"
+
+/* read index of the consumer, after applying a pending discard. As the
+ * producer stores the discard position before bumping the counter, the
+ * position loaded after the counter is at least as recent */
+static uint16_t _reads(spscrb_t *rb)
+{
+    uint8_t discards = atomic_load_u8(&rb->discards);
+
+    if (discards != rb->discards_seen) {
+        uint16_t reads = atomic_load_u16(&rb->discard);
+
+        rb->discards_seen = discards;
+        atomic_store_u16(&rb->reads, reads);
+        return reads;
+    }
+    return rb->reads;
+}
+
+static size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+static void _copy_out(const spscrb_t *rb, uint16_t pos, uint8_t *dst, size_t n)
+{
+    size_t idx = pos & (rb->size - 1);
+    size_t first = _min(n, rb->size - idx);
+
+    memcpy(dst, &rb->buf[idx], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+int spscrb_add_one(spscrb_t *rb, uint8_t c)
+{
+    if (spscrb_full(rb)) {
+        return -1;
+    }
+    rb->buf[rb->writes & (rb->size - 1)] = c;
+    spscrb_commit(rb, 1);
+    return 0;
+}
+
+size_t spscrb_add(spscrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t idx = rb->writes & (rb->size - 1);
+    size_t first;
+
+    n = _min(n, spscrb_free(rb));
+    first = _min(n, rb->size - idx);
+    memcpy(&rb->buf[idx], src, first);
+    memcpy(rb->buf, src + first, n - first);
+    spscrb_commit(rb, n);
+    return n;
+}
+
+uint8_t *spscrb_reserve(spscrb_t *rb, size_t *len)
+{
+    size_t idx = rb->writes & (rb->size - 1);
+
+    *len = _min(spscrb_free(rb), rb->size - idx);
+    return &rb->buf[idx];
+}
+
+int spscrb_get_one(spscrb_t *rb)
+{
+    int c = spscrb_peek_one(rb);
+
+    if (c >= 0) {
+        atomic_store_u16(&rb->reads, rb->reads + 1);
+    }
+    return c;
+}
+
+int spscrb_peek_one(spscrb_t *rb)
+{
+    uint16_t reads = _reads(rb);
+
+    if (atomic_load_u16(&rb->writes) == reads) {
+        return -1;
+    }
+    return rb->buf[reads & (rb->size - 1)];
+}
+
+size_t spscrb_get(spscrb_t *rb, uint8_t *dst, size_t n)
+{
+    n = spscrb_peek(rb, dst, n);
+    atomic_store_u16(&rb->reads, rb->reads + n);
+    return n;
+}
+
+size_t spscrb_peek(spscrb_t *rb, uint8_t *dst, size_t n)
+{
+    uint16_t reads = _reads(rb);
+
+    n = _min(n, (uint16_t)(atomic_load_u16(&rb->writes) - reads));
+    _copy_out(rb, reads, dst, n);
+    return n;
+}
+
+const uint8_t *spscrb_peek_contig(spscrb_t *rb, size_t *len)
+{
+    uint16_t reads = _reads(rb);
+    size_t idx = reads & (rb->size - 1);
+
+    *len = _min((uint16_t)(atomic_load_u16(&rb->writes) - reads),
+                rb->size - idx);
+    return &rb->buf[idx];
+}
+
+size_t spscrb_consume(spscrb_t *rb, size_t n)
+{
+    uint16_t reads = _reads(rb);
+
+    n = _min(n, (uint16_t)(atomic_load_u16(&rb->writes) - reads));
+    atomic_store_u16(&rb->reads, reads + n);
+    return n;
+}
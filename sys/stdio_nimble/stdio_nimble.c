@@ -186,7 +186,7 @@ static const struct ble_gatt_svc_def _gatt_svr_svcs[] =
 
 static void _purge_buffer(void)
 {
-    tsrb_clear(&_isrpipe_stdin.tsrb);
+    spscrb_discard(&_isrpipe_stdin.rb);
 
 #if IS_USED(MODULE_SHELL)
     /* send Ctrl-C to the shell to reset the input */
@@ -322,7 +322,7 @@ void stdio_init(void)
 #if IS_USED(MODULE_STDIO_AVAILABLE)
 int stdio_available(void)
 {
-    return tsrb_avail(&_isrpipe_stdin.tsrb);
+    return spscrb_avail(&_isrpipe_stdin.rb);
 }
 #endif
 
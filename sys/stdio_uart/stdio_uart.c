@@ -70,7 +70,7 @@ void stdio_init(void)
 #if IS_USED(MODULE_STDIO_AVAILABLE)
 int stdio_available(void)
 {
-    return tsrb_avail(&stdio_uart_isrpipe.tsrb);
+    return spscrb_avail(&stdio_uart_isrpipe.rb);
 }
 #endif
 
@@ -54,7 +54,7 @@ void stdio_init(void)
 #if IS_USED(MODULE_STDIO_AVAILABLE)
 int stdio_available(void)
 {
-    return tsrb_avail(&_cdc_stdio_isrpipe.tsrb);
+    return spscrb_avail(&_cdc_stdio_isrpipe.rb);
 }
 #endif
 
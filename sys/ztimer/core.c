@@ -32,6 +32,9 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#ifdef MODULE_ZTIMER_HEAP
+#include "ztimer/heap.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -49,11 +52,36 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+#ifdef MODULE_ZTIMER_HEAP
+    return clock->heap;
+#else
+    (void)clock;
+    return false;
+#endif
+}
+
+/* ticks from the clock's base until the first timer, which must exist */
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    if (_uses_heap(clock)) {
+        /* timers in a heap store their absolute target */
+        return clock->list.next->offset - clock->list.offset;
+    }
+    return clock->list.next->offset;
+}
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
         return 0;
     }
+#ifdef MODULE_ZTIMER_HEAP
+    else if (clock->heap) {
+        return _ztimer_heap_is_set(clock, &t->base);
+    }
+#endif
     else {
         return (t->base.next || &t->base == clock->last);
     }
@@ -135,6 +163,13 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#ifdef MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        _ztimer_heap_add(clock, entry);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -202,6 +237,12 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     DEBUG(
         "clock %p: _ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
+#ifdef MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        _ztimer_heap_advance(clock, now);
+    }
+    else
+#endif
     if (entry) {
         do {
             if (diff <= entry->offset) {
@@ -243,27 +284,35 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
-        ztimer_base_t *list_entry = list->next;
-        if (list_entry == entry) {
-            if (entry == clock->last) {
-                /* if entry was the last timer, set the clocks last to the
-                 * previous entry, or NULL if that was the list ptr */
-                clock->last = (list == &clock->list) ? NULL : list;
-            }
+#ifdef MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        was_removed = _ztimer_heap_del(clock, entry);
+    }
+    else
+#endif
+    {
+        while (list->next) {
+            ztimer_base_t *list_entry = list->next;
+            if (list_entry == entry) {
+                if (entry == clock->last) {
+                    /* if entry was the last timer, set the clocks last to the
+                     * previous entry, or NULL if that was the list ptr */
+                    clock->last = (list == &clock->list) ? NULL : list;
+                }
 
-            list->next = entry->next;
-            if (list->next) {
-                list_entry = list->next;
-                list_entry->offset += entry->offset;
-            }
+                list->next = entry->next;
+                if (list->next) {
+                    list_entry = list->next;
+                    list_entry->offset += entry->offset;
+                }
 
-            was_removed = true;
-            /* reset the entry's next pointer so _is_set() considers it unset */
-            entry->next = NULL;
-            break;
+                was_removed = true;
+                /* reset the entry's next pointer so _is_set() considers it unset */
+                entry->next = NULL;
+                break;
+            }
+            list = list->next;
         }
-        list = list->next;
     }
 
 #ifdef MODULE_PM_LAYERED
@@ -281,6 +330,22 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
     ztimer_base_t *entry = clock->list.next;
 
+#ifdef MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        if (!entry || _head_offset(clock)) {
+            return NULL;
+        }
+        _ztimer_heap_pop(clock);
+#ifdef MODULE_PM_LAYERED
+        if (!clock->list.next &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+#endif
+
     if (entry && (entry->offset == 0)) {
         clock->list.next = entry->next;
         if (!entry->next) {
@@ -309,7 +374,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -321,7 +386,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -349,7 +414,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -374,8 +439,13 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+        if (_uses_heap(clock)) {
+            clock->list.offset = clock->list.next->offset;
+        }
+        else {
+            clock->list.offset += clock->list.next->offset;
+            clock->list.next->offset = 0;
+        }
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
@@ -409,6 +479,12 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+    if (_uses_heap(clock)) {
+        printf("heap base %" PRIu32 " first %p\n", clock->list.offset,
+               (void *)clock->list.next);
+        return;
+    }
+
     do {
         printf("0x%08x:%" PRIu32 "(%" PRIu32 ")%s", (unsigned)entry,
                entry->offset, entry->offset +
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_heap
+ * @{
+ *
+ * @file
+ * @brief       ztimer pairing heap timer queue
+ *
+ * Timers in the heap store their absolute target time in `offset`. Keys are
+ * compared relative to the clock's base (`clock->list.offset`), which ztimer
+ * core only ever moves forward up to the first target, or past expired
+ * targets using @ref _ztimer_heap_advance().
+ *
+ * Each node uses `child` for its leftmost child, `next` for its right sibling
+ * and `prev` for either its left sibling or, if it is the leftmost child, its
+ * parent. The root has no `prev`, which allows to tell whether a timer is set.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+
+#include "irq.h"
+#include "ztimer.h"
+#include "ztimer/heap.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline uint32_t _key(const ztimer_clock_t *clock,
+                            const ztimer_base_t *entry)
+{
+    return entry->offset - clock->list.offset;
+}
+
+/* link two detached heaps, returns the new root */
+static ztimer_base_t *_meld(const ztimer_clock_t *clock, ztimer_base_t *a,
+                            ztimer_base_t *b)
+{
+    if (_key(clock, b) < _key(clock, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/* two-pass pairing of a sibling list, returns the resulting root */
+static ztimer_base_t *_merge_pairs(const ztimer_clock_t *clock,
+                                   ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+
+    /* first pass: meld pairs from left to right, stacking up the results */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = NULL;
+        a->prev = NULL;
+        if (b) {
+            b->next = NULL;
+            b->prev = NULL;
+            a = _meld(clock, a, b);
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the stacked pairs from right to left */
+    ztimer_base_t *root = NULL;
+
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = root ? _meld(clock, root, pairs) : pairs;
+        pairs = next;
+    }
+
+    return root;
+}
+
+static void _insert(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+
+    if (clock->list.next) {
+        clock->list.next = _meld(clock, clock->list.next, entry);
+    }
+    else {
+        clock->list.next = entry;
+    }
+}
+
+void ztimer_heap_enable(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+
+    if (!clock->heap) {
+        ztimer_base_t *entry = clock->list.next;
+        uint32_t target = clock->list.offset;
+
+        clock->list.next = NULL;
+        clock->last = NULL;
+        clock->heap = true;
+
+        /* convert the delta list into absolute targets */
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            target += entry->offset;
+            entry->offset = target;
+            _insert(clock, entry);
+            entry = next;
+        }
+    }
+
+    irq_restore(state);
+}
+
+void _ztimer_heap_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    entry->offset += clock->list.offset;
+    _insert(clock, entry);
+    DEBUG("_ztimer_heap_add() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+
+ztimer_base_t *_ztimer_heap_pop(ztimer_clock_t *clock)
+{
+    ztimer_base_t *root = clock->list.next;
+
+    assert(root);
+    clock->list.next = _merge_pairs(clock, root->child);
+    root->child = NULL;
+
+    return root;
+}
+
+bool _ztimer_heap_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    if (!_ztimer_heap_is_set(clock, entry)) {
+        return false;
+    }
+
+    if (entry == clock->list.next) {
+        _ztimer_heap_pop(clock);
+        return true;
+    }
+
+    /* unlink the subtree rooted at entry from its parent or left sibling */
+    if (entry->prev->child == entry) {
+        entry->prev->child = entry->next;
+    }
+    else {
+        entry->prev->next = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    }
+    entry->next = NULL;
+    entry->prev = NULL;
+
+    /* the children of entry form a heap of their own, put it back */
+    ztimer_base_t *sub = _merge_pairs(clock, entry->child);
+
+    entry->child = NULL;
+    if (sub) {
+        clock->list.next = _meld(clock, clock->list.next, sub);
+    }
+
+    return true;
+}
+
+void _ztimer_heap_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    uint32_t diff = now - clock->list.offset;
+    ztimer_base_t *expired = NULL;
+
+    /* collect all timers whose target lies before the new base */
+    while (clock->list.next && (_key(clock, clock->list.next) < diff)) {
+        ztimer_base_t *entry = _ztimer_heap_pop(clock);
+
+        entry->next = expired;
+        expired = entry;
+    }
+
+    clock->list.offset = now;
+
+    /* re-insert them as due right now */
+    while (expired) {
+        ztimer_base_t *entry = expired;
+
+        expired = entry->next;
+        entry->offset = now;
+        _insert(clock, entry);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Event loop benchmark
+ *
+ * Posts events in bursts to an event loop running in a thread of lower
+ * priority and measures how many events per second it handles.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "event.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_EVENTS
+#define NUMOF_EVENTS        (16000U)
+#endif
+
+#define MAX_BURST           (16U)
+#define THREAD_FLAG_DONE    (0x2)
+
+static const unsigned _bursts[] = { 1, 4, MAX_BURST };
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+static event_t _events[MAX_BURST];
+static thread_t *_main;
+static unsigned _handled;
+static unsigned _expected;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    if (++_handled == _expected) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+static uint32_t _run(unsigned burst, uint32_t *failed)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t time;
+
+    for (unsigned i = 0; i < NUMOF_EVENTS; i += burst) {
+        _expected = _handled + burst;
+        for (unsigned j = 0; j < burst; j++) {
+            event_post(&_queue, &_events[j]);
+        }
+        thread_flags_wait_any(THREAD_FLAG_DONE);
+        if (_handled != _expected) {
+            (*failed)++;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    return (uint32_t)(((uint64_t)NUMOF_EVENTS * US_PER_SEC) / time);
+}
+
+int main(void)
+{
+    uint32_t failed = 0;
+
+    printf("main starting, %u events, batch: %u\n", NUMOF_EVENTS,
+           IS_USED(MODULE_EVENT_LOOP_BATCH));
+
+    _main = thread_get_active();
+    for (unsigned i = 0; i < MAX_BURST; i++) {
+        _events[i].handler = _handler;
+    }
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _consumer, NULL, "consumer");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_bursts); i++) {
+        uint32_t result = _run(_bursts[i], &failed);
+
+        printf("{ \"burst\" : %u, \"result\" : %" PRIu32 " }\n",
+               _bursts[i], result);
+    }
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
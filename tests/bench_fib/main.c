@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIB next hop lookup benchmark
+ *
+ * Fills a FIB table with 10, 100, and 1000 host routes next to a few prefixes
+ * and a default route and measures how long it takes to find the next hop for
+ * destinations spread over all of them.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "mutex.h"
+#include "net/fib.h"
+#include "net/fib/table.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef MAX_ROUTES
+#define MAX_ROUTES          (1000U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (10000U)
+#endif
+
+#define ADDR_LEN            (16U)
+#define IFACE               (6)
+#define NUMOF_PREFIXES      (4U)
+#define PREFIX_LEN          (48U)
+/* every n-th lookup is for a destination without a host route */
+#define PREFIX_LOOKUP_RATIO (8U)
+/* host routes, prefixes, and the default route */
+#define TABLE_SIZE          (MAX_ROUTES + NUMOF_PREFIXES + 1)
+
+static fib_entry_t _entries[TABLE_SIZE];
+static fib_table_t _table = { .data.entries = _entries,
+                              .table_type = FIB_TABLE_TYPE_SH,
+                              .size = TABLE_SIZE,
+                              .mtx_access = MUTEX_INIT,
+                              .notify_rp_pos = 0 };
+
+/* host routes go to 2001:db8::<idx> */
+static void _host_dst(uint8_t *dst, unsigned idx)
+{
+    memset(dst, 0, ADDR_LEN);
+    dst[0] = 0x20;
+    dst[1] = 0x01;
+    dst[2] = 0x0d;
+    dst[3] = 0xb8;
+    dst[14] = (idx + 1) >> 8;
+    dst[15] = (idx + 1) & 0xff;
+}
+
+/* prefixes are 2001:db8:<idx + 1>::/48, the default route is idx == NUMOF_PREFIXES */
+static void _prefix_dst(uint8_t *dst, unsigned idx, bool random_iid)
+{
+    _host_dst(dst, 0);
+    dst[15] = 0;
+    if (idx < NUMOF_PREFIXES) {
+        dst[5] = idx + 1;
+    }
+    else {
+        dst[0] = 0x3f;
+    }
+    if (random_iid) {
+        random_bytes(&dst[8], 8);
+    }
+}
+
+/* next hops are fe80::<n> */
+static void _next_hop(uint8_t *next_hop, unsigned n)
+{
+    memset(next_hop, 0, ADDR_LEN);
+    next_hop[0] = 0xfe;
+    next_hop[1] = 0x80;
+    next_hop[15] = n + 1;
+}
+
+static int _add_routes(unsigned from, unsigned to)
+{
+    for (unsigned i = from; i < to; i++) {
+        uint8_t dst[ADDR_LEN], next_hop[ADDR_LEN];
+
+        _host_dst(dst, i);
+        _next_hop(next_hop, i % NUMOF_PREFIXES);
+        if (fib_add_entry(&_table, IFACE, dst, sizeof(dst), 0, next_hop,
+                          sizeof(next_hop), 0, (uint32_t)FIB_LIFETIME_NO_EXPIRE) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _add_prefixes(void)
+{
+    for (unsigned i = 0; i < NUMOF_PREFIXES; i++) {
+        uint8_t dst[ADDR_LEN], next_hop[ADDR_LEN];
+
+        _prefix_dst(dst, i, false);
+        _next_hop(next_hop, NUMOF_PREFIXES + i);
+        if (fib_add_entry(&_table, IFACE, dst, sizeof(dst),
+                          PREFIX_LEN << FIB_FLAG_NET_PREFIX_SHIFT, next_hop,
+                          sizeof(next_hop), 0, (uint32_t)FIB_LIFETIME_NO_EXPIRE) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _add_default_route(void)
+{
+    uint8_t dst[ADDR_LEN] = { 0 }, next_hop[ADDR_LEN];
+
+    _next_hop(next_hop, 2 * NUMOF_PREFIXES);
+    return fib_add_entry(&_table, IFACE, dst, sizeof(dst), 0, next_hop,
+                         sizeof(next_hop), 0, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+}
+
+static uint32_t _run(unsigned numof, uint32_t *failed)
+{
+    uint32_t start, duration = 0;
+
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        uint8_t dst[ADDR_LEN], next_hop[ADDR_LEN], exp[ADDR_LEN];
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+        kernel_pid_t iface = KERNEL_PID_UNDEF;
+
+        /* only the lookup counts, not making up the destination */
+        if ((i % PREFIX_LOOKUP_RATIO) == 0) {
+            unsigned idx = (i / PREFIX_LOOKUP_RATIO) % (NUMOF_PREFIXES + 1);
+
+            _prefix_dst(dst, idx, true);
+            _next_hop(exp, NUMOF_PREFIXES + idx);
+        }
+        else {
+            _host_dst(dst, i % numof);
+            _next_hop(exp, (i % numof) % NUMOF_PREFIXES);
+        }
+        start = ztimer_now(ZTIMER_USEC);
+        int res = fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                                   &next_hop_flags, dst, sizeof(dst), 0);
+
+        duration += ztimer_now(ZTIMER_USEC) - start;
+        if ((res < 0) || (iface != IFACE) ||
+            (next_hop_size != sizeof(exp)) ||
+            (memcmp(next_hop, exp, sizeof(exp)) != 0)) {
+            (*failed)++;
+        }
+    }
+    return duration;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+    uint32_t failed = 0;
+
+    printf("main starting, %u lookups, index: %u\n", NUMOF_LOOKUPS,
+           IS_USED(MODULE_FIB_INDEX));
+
+    fib_init(&_table);
+    if ((_add_prefixes() < 0) || (_add_default_route() < 0)) {
+        puts("error: unable to add prefix");
+        return 1;
+    }
+
+    for (unsigned step = 10; step <= MAX_ROUTES; step *= 10) {
+        if (_add_routes(numof, step) < 0) {
+            puts("error: unable to add route");
+            return 1;
+        }
+        numof = step;
+        printf("{ \"routes\" : %u, \"result\" : %" PRIu32 " }\n", numof,
+               _run(numof, &failed));
+    }
+
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"main starting, \d+ lookups, index: \d")
+    child.expect(r"{ \"routes\" : 10, \"result\" : \d+ }")
+    child.expect(r"{ \"routes\" : 100, \"result\" : \d+ }")
+    if child.expect([r"{ \"routes\" : 1000, \"result\" : \d+ }",
+                     r"{ \"failed\" : 0 }"]) == 0:
+        child.expect(r"{ \"failed\" : 0 }")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gcoap congestion control benchmark
+ *
+ * Sends a burst of confirmable requests to a CoAP server via a network
+ * interface whose driver drops a configurable share of the outgoing frames.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "iolist.h"
+#include "msg.h"
+#include "net/ethertype.h"
+#include "net/gcoap.h"
+#include "net/gnrc/netif.h"
+#include "net/protnum.h"
+#include "net/sock/util.h"
+#include "random.h"
+#include "shell.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+
+/* offsets in an Ethernet frame carrying IPv6 and UDP */
+#define ETHERTYPE_OFFSET    (12)
+#define NEXT_HDR_OFFSET     (14 + 6)
+#define DST_PORT_OFFSET     (14 + 40 + 2)
+#define COAP_OFFSET         (14 + 40 + 8)
+
+enum {
+    MSG_TYPE_RESPONSE,
+    MSG_TYPE_TIMEOUT,
+};
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+static kernel_pid_t _main_pid;
+static netdev_driver_t _driver;
+static const netdev_driver_t *_parent;
+static uint16_t _port;
+static unsigned _loss;
+static unsigned _transmissions;
+static unsigned _dropped;
+
+/* counts transmissions of confirmable requests to the server */
+static void _count(const iolist_t *iolist)
+{
+    uint8_t frame[COAP_OFFSET + 2];
+    size_t len = 0;
+
+    for (; iolist && (len < sizeof(frame)); iolist = iolist->iol_next) {
+        size_t part = iolist->iol_len;
+
+        if (part > sizeof(frame) - len) {
+            part = sizeof(frame) - len;
+        }
+        memcpy(&frame[len], iolist->iol_base, part);
+        len += part;
+    }
+    if ((len == sizeof(frame)) &&
+        (byteorder_bebuftohs(&frame[ETHERTYPE_OFFSET]) == ETHERTYPE_IPV6) &&
+        (frame[NEXT_HDR_OFFSET] == PROTNUM_UDP) &&
+        (byteorder_bebuftohs(&frame[DST_PORT_OFFSET]) == _port) &&
+        (((frame[COAP_OFFSET] & 0x30) >> 4) == COAP_TYPE_CON) &&
+        ((frame[COAP_OFFSET + 1] >> 5) == COAP_CLASS_REQ)) {
+        _transmissions++;
+    }
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    _count(iolist);
+    if (random_uint32_range(0, 100) < _loss) {
+        _dropped++;
+        return iolist_size(iolist);
+    }
+    return _parent->send(dev, iolist);
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    msg_t msg = { .type = MSG_TYPE_RESPONSE };
+
+    (void)pdu;
+    (void)remote;
+    if (memo->state != GCOAP_MEMO_RESP) {
+        msg.type = MSG_TYPE_TIMEOUT;
+    }
+    msg_try_send(&msg, _main_pid);
+}
+
+static ssize_t _request(const sock_udp_ep_t *remote)
+{
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    gcoap_req_init(&pdu, _buf, sizeof(_buf), COAP_METHOD_GET, "/bench");
+    coap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    return gcoap_req_send(_buf, len, remote, _resp_handler, NULL);
+}
+
+static int _bench_cmd(int argc, char **argv)
+{
+    sock_udp_ep_t remote;
+    unsigned requests, sent = 0, done = 0, timeouts = 0;
+    uint32_t start, time;
+
+    if (argc < 4) {
+        printf("usage: %s <[addr%%netif]:port> <requests> <loss in %%>\n",
+               argv[0]);
+        return 1;
+    }
+    if (sock_udp_str2ep(&remote, argv[1]) < 0) {
+        puts("error: invalid endpoint");
+        return 1;
+    }
+    requests = strtoul(argv[2], NULL, 10);
+
+    _port = remote.port;
+    _transmissions = 0;
+    _dropped = 0;
+    _loss = atoi(argv[3]);
+    start = ztimer_now(ZTIMER_USEC);
+    while (done < requests) {
+        msg_t msg;
+
+        /* send as many requests as gcoap accepts */
+        while ((sent < requests) && (_request(&remote) > 0)) {
+            sent++;
+        }
+        if (sent == done) {
+            puts("error: request not sent");
+            break;
+        }
+        msg_receive(&msg);
+        if (msg.type == MSG_TYPE_TIMEOUT) {
+            timeouts++;
+        }
+        done++;
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    _loss = 0;
+
+    if (done < requests) {
+        return 1;
+    }
+    printf("{ \"requests\" : %u, \"loss\" : %s, \"dropped\" : %u, "
+           "\"congure\" : %u, \"timeouts\" : %u, \"retransmissions\" : %u, "
+           "\"time\" : %" PRIu32 " }\n", requests, argv[3], _dropped,
+           IS_USED(MODULE_GCOAP_CONGURE), timeouts, _transmissions - requests,
+           time);
+    return 0;
+}
+
+#if IS_USED(MODULE_GCOAP_CONGURE)
+static int _nstart_cmd(int argc, char **argv)
+{
+    sock_udp_ep_t remote;
+    unsigned sent = 0;
+    ssize_t exceeding, resumed = 0;
+    msg_t msg;
+
+    if (argc < 2) {
+        printf("usage: %s <[addr%%netif]:port>\n", argv[0]);
+        return 1;
+    }
+    if (sock_udp_str2ep(&remote, argv[1]) < 0) {
+        puts("error: invalid endpoint");
+        return 1;
+    }
+    if (CONFIG_GCOAP_CONGURE_NSTART >= CONFIG_GCOAP_REQ_WAITING_MAX) {
+        /* the request would be dropped for lack of memos otherwise */
+        puts("error: NSTART not below REQ_WAITING_MAX");
+        return 1;
+    }
+    _port = remote.port;
+
+    /* fill the window of the endpoint ... */
+    while ((sent < CONFIG_GCOAP_CONGURE_NSTART) && (_request(&remote) > 0)) {
+        sent++;
+    }
+    /* ... so that gcoap drops the next request to it */
+    exceeding = (sent == CONFIG_GCOAP_CONGURE_NSTART) ? _request(&remote) : 0;
+    for (unsigned i = 0; i < sent; i++) {
+        msg_receive(&msg);
+    }
+    /* a response or timeout opens the window again */
+    if (sent > 0) {
+        resumed = _request(&remote);
+        if (resumed > 0) {
+            msg_receive(&msg);
+        }
+    }
+    printf("{ \"nstart\" : %u, \"sent\" : %u, \"exceeding\" : %d, "
+           "\"resumed\" : %d }\n", (unsigned)CONFIG_GCOAP_CONGURE_NSTART,
+           sent, (int)exceeding, (int)resumed);
+    return 0;
+}
+#endif
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "send CoAP requests and measure completion time", _bench_cmd },
+#if IS_USED(MODULE_GCOAP_CONGURE)
+    { "nstart", "check that gcoap drops requests beyond NSTART", _nstart_cmd },
+#endif
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    _main_pid = thread_getpid();
+
+    /* let the driver of the interface drop frames */
+    _parent = netif->dev->driver;
+    _driver = *_parent;
+    _driver.send = _send;
+    netif->dev->driver = &_driver;
+
+    printf("gcoap congestion control benchmark, congure %s\n",
+           IS_USED(MODULE_GCOAP_CONGURE) ? "on" : "off");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import sys
+import threading
+from testrunner import run
+
+REQUESTS = 50
+LOSS = (0, 5, 10, 20)
+# Processing delay of the server in seconds
+DELAY = 0.05
+
+COAP_TYPE_CON = 0
+COAP_TYPE_ACK = 2
+COAP_CODE_CONTENT = 0x45
+
+
+def _host_address():
+    # Use the bridge if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search('master (.*) state',
+                       os.popen('bridge link show dev {}'.format(tap)).read())
+    interface = bridge.group(1).strip() if bridge else tap
+    result = os.popen('ip addr show dev {} scope link'.format(interface)).read()
+    return re.search('inet6 (.*)/64', result).group(1).strip()
+
+
+def _serve(sock, stop):
+    # Answer each confirmable request with a piggybacked 2.05 response
+    sock.settimeout(0.1)
+    while not stop.is_set():
+        try:
+            data, remote = sock.recvfrom(1024)
+        except socket.timeout:
+            continue
+        if len(data) < 4 or ((data[0] >> 4) & 0x3) != COAP_TYPE_CON:
+            continue
+        tkl = data[0] & 0xf
+        response = bytes([(data[0] & 0xc0) | (COAP_TYPE_ACK << 4) | tkl,
+                          COAP_CODE_CONTENT]) + data[2:4 + tkl]
+        threading.Timer(DELAY, sock.sendto, args=(response, remote)).start()
+
+
+def testfunc(child):
+    child.expect(r"gcoap congestion control benchmark, congure (on|off)")
+    congure = child.match.group(1) == "on"
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    iface = child.match.group(1).strip()
+    addr = _host_address()
+
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        sock.bind(('::', 0))
+        port = sock.getsockname()[1]
+        stop = threading.Event()
+        server = threading.Thread(target=_serve, args=(sock, stop))
+        server.start()
+        try:
+            if congure:
+                # gcoap_req_send() returns 0 while NSTART requests to the
+                # server are outstanding
+                child.sendline('nstart [{}%{}]:{}'.format(addr, iface, port))
+                child.expect(r'{ "nstart" : (\d+), "sent" : (\d+), '
+                             r'"exceeding" : (-?\d+), "resumed" : (-?\d+) }')
+                assert child.match.group(1) == child.match.group(2)
+                assert int(child.match.group(3)) == 0
+                assert int(child.match.group(4)) > 0
+            for loss in LOSS:
+                child.sendline('bench [{}%{}]:{} {} {}'.format(addr, iface, port,
+                                                              REQUESTS, loss))
+                child.expect(r'{ "requests" : \d+, "loss" : \d+, '
+                             r'"dropped" : \d+, "congure" : \d, '
+                             r'"timeouts" : (\d+), "retransmissions" : \d+, '
+                             r'"time" : \d+ }', timeout=600)
+                if loss == 0:
+                    assert int(child.match.group(1)) == 0
+        finally:
+            stop.set()
+            server.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
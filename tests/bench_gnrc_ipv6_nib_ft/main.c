@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark
+ *
+ * Fills the forwarding table with 10, 100, and 1000 routes and measures how
+ * long it takes to find the route for destinations spread over all of them,
+ * as the IPv6 layer does for every packet it forwards.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef MAX_ROUTES
+#define MAX_ROUTES          (1000U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (10000U)
+#endif
+
+#define IFACE               (6U)
+#define NUMOF_NEXT_HOPS     (4U)
+
+static const ipv6_addr_t _aggregate = {
+    .u8 = { 0x20, 0x01, 0x0d, 0xb8 }
+};
+
+/* routes to 2001:db8:<idx>::/48, /56, or /64 via one of a few next hops */
+static unsigned _route_len(unsigned idx)
+{
+    return 48 + ((idx % 3) * 8);
+}
+
+static void _route_dst(ipv6_addr_t *dst, unsigned idx, bool random_iid)
+{
+    *dst = _aggregate;
+    dst->u8[4] = (idx + 1) >> 8;
+    dst->u8[5] = (idx + 1) & 0xff;
+    if (random_iid) {
+        random_bytes(&dst->u8[8], 8);
+    }
+}
+
+static void _next_hop(ipv6_addr_t *next_hop, unsigned idx)
+{
+    ipv6_addr_set_link_local_prefix(next_hop);
+    next_hop->u64[1].u64 = 0;
+    next_hop->u8[15] = 1 + (idx % NUMOF_NEXT_HOPS);
+}
+
+static int _add_routes(unsigned from, unsigned to)
+{
+    for (unsigned i = from; i < to; i++) {
+        ipv6_addr_t dst, next_hop;
+
+        _route_dst(&dst, i, false);
+        _next_hop(&next_hop, i);
+        if (gnrc_ipv6_nib_ft_add(&dst, _route_len(i), &next_hop, IFACE,
+                                 0) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t _run(unsigned numof, uint32_t *failed)
+{
+    uint32_t start, duration = 0;
+
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        gnrc_ipv6_nib_ft_t fte;
+        ipv6_addr_t dst, next_hop;
+        unsigned idx = i % numof;
+
+        /* only the lookup counts, not making up the destination */
+        _route_dst(&dst, idx, true);
+        start = ztimer_now(ZTIMER_USEC);
+        int res = gnrc_ipv6_nib_ft_get(&dst, NULL, &fte);
+
+        duration += ztimer_now(ZTIMER_USEC) - start;
+        _next_hop(&next_hop, idx);
+        if ((res < 0) || (fte.dst_len != _route_len(idx)) ||
+            (ipv6_addr_match_prefix(&fte.dst, &dst) < fte.dst_len) ||
+            !ipv6_addr_equal(&fte.next_hop, &next_hop)) {
+            (*failed)++;
+        }
+    }
+    return duration;
+}
+
+int main(void)
+{
+    ipv6_addr_t next_hop;
+    unsigned numof = 0;
+    uint32_t failed = 0;
+
+    printf("main starting, %u lookups, trie: %u\n", NUMOF_LOOKUPS,
+           IS_USED(MODULE_GNRC_IPV6_NIB_FT_TRIE));
+
+    /* a route covering all others, so lookups have to pick the longest */
+    _next_hop(&next_hop, NUMOF_NEXT_HOPS);
+    if (gnrc_ipv6_nib_ft_add(&_aggregate, 32, &next_hop, IFACE, 0) < 0) {
+        puts("error: unable to add aggregate route");
+        return 1;
+    }
+
+    for (unsigned step = 10; step <= MAX_ROUTES; step *= 10) {
+        if (_add_routes(numof, step) < 0) {
+            puts("error: unable to add route");
+            return 1;
+        }
+        numof = step;
+        printf("{ \"routes\" : %u, \"result\" : %" PRIu32 " }\n", numof,
+               _run(numof, &failed));
+    }
+
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
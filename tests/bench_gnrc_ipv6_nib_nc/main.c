@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB neighbor cache lookup benchmark
+ *
+ * Fills the neighbor cache with 10, 100, and 1000 neighbors and measures how
+ * long it takes to find the neighbor cache entries for addresses spread over
+ * all of them, as the NIB does for every packet it sends to resolve the
+ * link-layer address of the next hop.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+#include "ztimer.h"
+
+#include "_nib-internal.h"
+
+#ifndef MAX_NEIGHBORS
+#define MAX_NEIGHBORS       (1000U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (10000U)
+#endif
+
+#define IFACE               (6U)
+
+/* neighbors fe80::<idx> and 2001:db8::<idx> */
+static void _neighbor(ipv6_addr_t *addr, unsigned idx)
+{
+    if (idx & 1) {
+        ipv6_addr_set_link_local_prefix(addr);
+    }
+    else {
+        ipv6_addr_from_str(addr, "2001:db8::");
+    }
+    addr->u64[1].u64 = 0;
+    addr->u8[14] = (idx + 1) >> 8;
+    addr->u8[15] = (idx + 1) & 0xff;
+}
+
+static int _add_neighbors(unsigned from, unsigned to)
+{
+    int res = 0;
+
+    _nib_acquire();
+    for (unsigned i = from; i < to; i++) {
+        ipv6_addr_t addr;
+
+        _neighbor(&addr, i);
+        if (_nib_nc_add(&addr, IFACE,
+                        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE) == NULL) {
+            res = -1;
+            break;
+        }
+    }
+    _nib_release();
+    return res;
+}
+
+static uint32_t _run(unsigned numof, uint32_t *failed)
+{
+    uint32_t start, duration = 0;
+
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        _nib_onl_entry_t *nce;
+        ipv6_addr_t addr;
+
+        /* only the lookup counts, not making up the address */
+        _neighbor(&addr, i % numof);
+        start = ztimer_now(ZTIMER_USEC);
+        _nib_acquire();
+        nce = _nib_onl_nc_get(&addr, IFACE);
+        _nib_release();
+        duration += ztimer_now(ZTIMER_USEC) - start;
+        if ((nce == NULL) || !ipv6_addr_equal(&nce->ipv6, &addr)) {
+            (*failed)++;
+        }
+    }
+    return duration;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+    uint32_t failed = 0;
+
+    printf("main starting, %u lookups, hash: %u\n", NUMOF_LOOKUPS,
+           IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH));
+
+    for (unsigned step = 10; step <= MAX_NEIGHBORS; step *= 10) {
+        if (_add_neighbors(numof, step) < 0) {
+            puts("error: unable to add neighbor");
+            return 1;
+        }
+        numof = step;
+        printf("{ \"neighbors\" : %u, \"result\" : %" PRIu32 " }\n", numof,
+               _run(numof, &failed));
+    }
+
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_netif receive path benchmark
+ *
+ * A dummy Ethernet device serves the same frame from memory, which the
+ * Ethernet interface receives over and over again, first via
+ * netdev_driver_t::recv and then via netdev_driver_t::recv_loan.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "byteorder.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev/eth.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_FRAMES
+#define NUMOF_FRAMES        (10000U)
+#endif
+
+#ifndef FRAME_SIZE
+#define FRAME_SIZE          (128U)
+#endif
+
+static const uint8_t _addr[ETHERNET_ADDR_LEN] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+static uint8_t _frame[FRAME_SIZE];
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_t _dev;
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    (void)iolist;
+    return -ENOTSUP;
+}
+
+static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        /* like netdev_tap, only an upper bound is known before reading */
+        return ETHERNET_FRAME_LEN;
+    }
+    if (len < sizeof(_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static int _recv_loan(netdev_t *dev, netdev_recv_alloc_t alloc, void *ctx,
+                      void *info)
+{
+    (void)dev;
+    (void)info;
+    void *buf = alloc(ctx, sizeof(_frame));
+
+    if (buf == NULL) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static int _init(netdev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static void _isr(netdev_t *dev)
+{
+    (void)dev;
+}
+
+static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
+{
+    if (opt == NETOPT_ADDRESS) {
+        if (max_len < sizeof(_addr)) {
+            return -EINVAL;
+        }
+        memcpy(value, _addr, sizeof(_addr));
+        return sizeof(_addr);
+    }
+    return netdev_eth_get(dev, opt, value, max_len);
+}
+
+static int _set(netdev_t *dev, netopt_t opt, const void *value,
+                size_t value_len)
+{
+    return netdev_eth_set(dev, opt, value, value_len);
+}
+
+static const netdev_driver_t _driver_recv = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static const netdev_driver_t _driver_recv_loan = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+    .recv_loan = _recv_loan,
+};
+
+static uint32_t _run(const netdev_driver_t *driver, uint32_t *failed)
+{
+    uint32_t start;
+
+    _dev.driver = driver;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_FRAMES; i++) {
+        gnrc_pktsnip_t *pkt = _netif.ops->recv(&_netif);
+
+        if ((pkt == NULL) ||
+            (pkt->size != (sizeof(_frame) - sizeof(ethernet_hdr_t))) ||
+            (memcmp(pkt->data, &_frame[sizeof(ethernet_hdr_t)],
+                    pkt->size) != 0)) {
+            (*failed)++;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_frame;
+    uint32_t failed = 0;
+    uint32_t recv, recv_loan;
+
+    printf("main starting, %u frames of %u bytes\n", NUMOF_FRAMES, FRAME_SIZE);
+
+    memcpy(hdr->dst, _addr, sizeof(_addr));
+    memset(hdr->src, 0x42, sizeof(hdr->src));
+    hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+    for (unsigned i = sizeof(*hdr); i < sizeof(_frame); i++) {
+        _frame[i] = i;
+    }
+
+    _dev.driver = &_driver_recv;
+    if (gnrc_netif_ethernet_create(&_netif, _stack, sizeof(_stack),
+                                   GNRC_NETIF_PRIO, "dummy", &_dev) < 0) {
+        puts("error: unable to create interface");
+        return 1;
+    }
+
+    recv = _run(&_driver_recv, &failed);
+    recv_loan = _run(&_driver_recv_loan, &failed);
+
+    printf("{ \"recv\" : %" PRIu32 ", \"recv_loan\" : %" PRIu32
+           ", \"failed\" : %" PRIu32 " }\n", recv, recv_loan, failed);
+
+    return 0;
+}
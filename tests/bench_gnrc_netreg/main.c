@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_netreg lookup benchmark
+ *
+ * Registers a growing number of entries with distinct demux contexts, like
+ * UDP sockets bound to different ports, and measures how long it takes to
+ * look each of them up.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef MAX_ENTRIES
+#define MAX_ENTRIES         (256U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (10000U)
+#endif
+
+#define MSG_QUEUE_SIZE      (4U)
+#define PORT_BASE           (49152U)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _entries[MAX_ENTRIES];
+/* registered with the same demux contexts, but for another type */
+static gnrc_netreg_entry_t _others[MAX_ENTRIES];
+
+static uint32_t _run(unsigned numof, uint32_t *failed)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        unsigned idx = i % numof;
+        gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                        PORT_BASE + idx);
+
+        if ((entry != &_entries[idx]) ||
+            (gnrc_netreg_getnext(entry) != NULL)) {
+            (*failed)++;
+        }
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    unsigned registered = 0;
+    uint32_t failed = 0;
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    printf("main starting, %u lookups, hash: %u\n", NUMOF_LOOKUPS,
+           IS_USED(MODULE_GNRC_NETREG_HASH));
+
+    for (unsigned numof = 1; numof <= MAX_ENTRIES; numof *= 2) {
+        for (; registered < numof; registered++) {
+            gnrc_netreg_entry_init_pid(&_entries[registered],
+                                       PORT_BASE + registered,
+                                       thread_getpid());
+            gnrc_netreg_entry_init_pid(&_others[registered],
+                                       PORT_BASE + registered,
+                                       thread_getpid());
+            gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[registered]);
+            gnrc_netreg_register(GNRC_NETTYPE_TCP, &_others[registered]);
+        }
+        printf("{ \"entries\" : %u, \"result\" : %" PRIu32 " }\n", numof,
+               _run(numof, &failed));
+    }
+
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
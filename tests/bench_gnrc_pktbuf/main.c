@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Multi-threaded gnrc_pktbuf throughput benchmark
+ *
+ * Several threads of the same priority build UDP-over-IPv6 shaped packets
+ * snip by snip, yield to each other while holding them, and release them
+ * again, until the test duration has passed.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/udp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef NUMOF_THREADS
+#define NUMOF_THREADS       (4U)
+#endif
+
+#ifndef PAYLOAD_SIZE
+#define PAYLOAD_SIZE        (32U)
+#endif
+
+static char _stacks[NUMOF_THREADS][THREAD_STACKSIZE_DEFAULT];
+static uint32_t _count[NUMOF_THREADS];
+static uint32_t _failed[NUMOF_THREADS];
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+/* the snip types do not matter to the packet buffer */
+static gnrc_pktsnip_t *_build(void)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = gnrc_pktbuf_add(pkt, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UNDEF);
+    if (hdr == NULL) {
+        goto error;
+    }
+    pkt = hdr;
+    hdr = gnrc_pktbuf_add(pkt, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_UNDEF);
+    if (hdr == NULL) {
+        goto error;
+    }
+    pkt = hdr;
+    hdr = gnrc_netif_hdr_build(addr, sizeof(addr), addr, sizeof(addr));
+    if (hdr == NULL) {
+        goto error;
+    }
+    hdr->next = pkt;
+    return hdr;
+
+error:
+    gnrc_pktbuf_release(pkt);
+    return NULL;
+}
+
+static void *_worker(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    while (!_flag) {
+        gnrc_pktsnip_t *pkt = _build();
+
+        if (pkt == NULL) {
+            _failed[idx]++;
+        }
+        /* let the other threads allocate while this packet is still alive */
+        thread_yield();
+        if (pkt != NULL) {
+            gnrc_pktbuf_release(pkt);
+            _count[idx]++;
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    ztimer_t timer = { .callback = _timer_callback };
+    uint32_t count = 0;
+    uint32_t failed = 0;
+
+    printf("main starting, %u threads, slab: %u\n", NUMOF_THREADS,
+           IS_USED(MODULE_GNRC_PKTBUF_STATIC_SLAB));
+
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+    /* the workers preempt main until the timer has fired */
+    for (unsigned i = 0; i < NUMOF_THREADS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      _worker, (void *)(uintptr_t)i, "worker");
+    }
+    thread_yield_higher();
+
+    for (unsigned i = 0; i < NUMOF_THREADS; i++) {
+        count += _count[i];
+        failed += _failed[i];
+    }
+
+    printf("{ \"result\" : %" PRIu32 ", \"failed\" : %" PRIu32 " }\n",
+           count, failed);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+
+    return 0;
+}
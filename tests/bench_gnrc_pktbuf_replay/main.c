@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Replays packet buffer allocation traces
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "ztimer.h"
+
+#include "pktbuf_trace.h"
+
+#ifndef REPEAT
+#define REPEAT          (100U)
+#endif
+
+static gnrc_pktsnip_t *_slots[PKTBUF_TRACE_SLOTS];
+
+/* returns the number of failed allocations */
+static unsigned _replay(bool print_stats)
+{
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i < pktbuf_trace_numof; i++) {
+        const pktbuf_trace_entry_t *entry = &pktbuf_trace[i];
+        gnrc_pktsnip_t **slot = &_slots[entry->slot];
+
+        switch (entry->op) {
+        case PKTBUF_TRACE_ALLOC:
+        case PKTBUF_TRACE_ALLOC_LONG:
+            if (entry->op == PKTBUF_TRACE_ALLOC_LONG) {
+                *slot = gnrc_pktbuf_add_long_lived(NULL, NULL, entry->size,
+                                                   GNRC_NETTYPE_UNDEF);
+            }
+            else {
+                *slot = gnrc_pktbuf_add(NULL, NULL, entry->size,
+                                        GNRC_NETTYPE_UNDEF);
+            }
+            if (*slot == NULL) {
+                failed++;
+#ifdef DEVELHELP
+                if (print_stats) {
+                    printf("allocation of %u bytes at entry %u failed\n",
+                           entry->size, i);
+                    gnrc_pktbuf_stats();
+                    print_stats = false;
+                }
+#endif
+            }
+            break;
+        case PKTBUF_TRACE_FREE:
+            if (*slot != NULL) {
+                gnrc_pktbuf_release(*slot);
+                *slot = NULL;
+            }
+            break;
+        }
+    }
+    (void)print_stats;
+    return failed;
+}
+
+int main(void)
+{
+    uint32_t start, duration;
+    unsigned failed;
+
+    printf("replaying %u entries, best-fit: %u\n",
+           (unsigned)pktbuf_trace_numof,
+           IS_USED(MODULE_GNRC_PKTBUF_STATIC_BESTFIT));
+
+    /* first pass reports the packet buffer state at the first failure */
+    failed = _replay(true);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < REPEAT; i++) {
+        _replay(false);
+    }
+    duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"result\" : %" PRIu32 ", \"failed\" : %u }\n",
+           duration / REPEAT, failed);
+
+    return 0;
+}
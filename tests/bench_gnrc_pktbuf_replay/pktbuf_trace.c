@@ -0,0 +1,944 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer allocation trace of a 6LoWPAN node
+ *
+ * Reassembly buffers of 640 to 1280 bytes are kept while the node sends
+ * UDP packets, each made of a payload, UDP, IPv6 and netif header snip that
+ * are released again after a few operations. Every packet allocated by the
+ * trace is released by its end.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#include "pktbuf_trace.h"
+
+const pktbuf_trace_entry_t pktbuf_trace[] = {
+    { PKTBUF_TRACE_ALLOC, 0, 218 },
+    { PKTBUF_TRACE_ALLOC, 1, 8 },
+    { PKTBUF_TRACE_ALLOC, 2, 40 },
+    { PKTBUF_TRACE_ALLOC, 3, 24 },
+    { PKTBUF_TRACE_ALLOC, 4, 290 },
+    { PKTBUF_TRACE_ALLOC, 5, 8 },
+    { PKTBUF_TRACE_ALLOC, 6, 40 },
+    { PKTBUF_TRACE_ALLOC, 7, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_ALLOC, 8, 275 },
+    { PKTBUF_TRACE_ALLOC, 9, 8 },
+    { PKTBUF_TRACE_ALLOC, 10, 40 },
+    { PKTBUF_TRACE_ALLOC, 11, 24 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 11, 0 },
+    { PKTBUF_TRACE_ALLOC, 12, 238 },
+    { PKTBUF_TRACE_ALLOC, 13, 8 },
+    { PKTBUF_TRACE_ALLOC, 14, 40 },
+    { PKTBUF_TRACE_ALLOC, 15, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_ALLOC, 16, 62 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_ALLOC, 20, 79 },
+    { PKTBUF_TRACE_ALLOC, 21, 8 },
+    { PKTBUF_TRACE_ALLOC, 22, 40 },
+    { PKTBUF_TRACE_ALLOC, 23, 24 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_ALLOC, 24, 219 },
+    { PKTBUF_TRACE_ALLOC, 25, 8 },
+    { PKTBUF_TRACE_ALLOC, 26, 40 },
+    { PKTBUF_TRACE_ALLOC, 27, 24 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 28, 800 },
+    { PKTBUF_TRACE_ALLOC, 29, 164 },
+    { PKTBUF_TRACE_ALLOC, 30, 8 },
+    { PKTBUF_TRACE_ALLOC, 31, 40 },
+    { PKTBUF_TRACE_ALLOC, 32, 24 },
+    { PKTBUF_TRACE_ALLOC, 33, 173 },
+    { PKTBUF_TRACE_ALLOC, 34, 8 },
+    { PKTBUF_TRACE_ALLOC, 35, 40 },
+    { PKTBUF_TRACE_ALLOC, 36, 24 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_ALLOC, 37, 68 },
+    { PKTBUF_TRACE_ALLOC, 38, 8 },
+    { PKTBUF_TRACE_ALLOC, 39, 40 },
+    { PKTBUF_TRACE_ALLOC, 40, 24 },
+    { PKTBUF_TRACE_ALLOC, 41, 206 },
+    { PKTBUF_TRACE_ALLOC, 42, 8 },
+    { PKTBUF_TRACE_ALLOC, 43, 40 },
+    { PKTBUF_TRACE_ALLOC, 44, 24 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_FREE, 38, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_ALLOC, 45, 46 },
+    { PKTBUF_TRACE_ALLOC, 46, 8 },
+    { PKTBUF_TRACE_ALLOC, 47, 40 },
+    { PKTBUF_TRACE_ALLOC, 0, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 1, 288 },
+    { PKTBUF_TRACE_ALLOC, 2, 8 },
+    { PKTBUF_TRACE_ALLOC, 3, 40 },
+    { PKTBUF_TRACE_ALLOC, 4, 24 },
+    { PKTBUF_TRACE_ALLOC, 5, 254 },
+    { PKTBUF_TRACE_ALLOC, 6, 8 },
+    { PKTBUF_TRACE_ALLOC, 7, 40 },
+    { PKTBUF_TRACE_ALLOC, 8, 24 },
+    { PKTBUF_TRACE_ALLOC, 9, 201 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 11, 40 },
+    { PKTBUF_TRACE_ALLOC, 12, 24 },
+    { PKTBUF_TRACE_ALLOC, 13, 140 },
+    { PKTBUF_TRACE_ALLOC, 14, 8 },
+    { PKTBUF_TRACE_ALLOC, 15, 40 },
+    { PKTBUF_TRACE_ALLOC, 16, 24 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_ALLOC, 17, 284 },
+    { PKTBUF_TRACE_ALLOC, 18, 8 },
+    { PKTBUF_TRACE_ALLOC, 19, 40 },
+    { PKTBUF_TRACE_ALLOC, 20, 24 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_ALLOC, 21, 245 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 11, 0 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 76 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_ALLOC, 30, 191 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_ALLOC, 34, 231 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 38, 640 },
+    { PKTBUF_TRACE_ALLOC, 39, 190 },
+    { PKTBUF_TRACE_ALLOC, 40, 8 },
+    { PKTBUF_TRACE_ALLOC, 0, 40 },
+    { PKTBUF_TRACE_ALLOC, 41, 24 },
+    { PKTBUF_TRACE_ALLOC, 42, 249 },
+    { PKTBUF_TRACE_ALLOC, 43, 8 },
+    { PKTBUF_TRACE_ALLOC, 44, 40 },
+    { PKTBUF_TRACE_ALLOC, 45, 24 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 46, 154 },
+    { PKTBUF_TRACE_ALLOC, 47, 8 },
+    { PKTBUF_TRACE_ALLOC, 1, 40 },
+    { PKTBUF_TRACE_ALLOC, 2, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 47 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 244 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 13, 40 },
+    { PKTBUF_TRACE_ALLOC, 14, 24 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_ALLOC, 15, 193 },
+    { PKTBUF_TRACE_ALLOC, 16, 8 },
+    { PKTBUF_TRACE_ALLOC, 9, 40 },
+    { PKTBUF_TRACE_ALLOC, 10, 24 },
+    { PKTBUF_TRACE_ALLOC_LONG, 11, 1280 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_ALLOC, 12, 268 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 20, 1000 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 216 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_ALLOC, 21, 57 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_ALLOC, 30, 297 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_ALLOC, 34, 236 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_ALLOC, 0, 228 },
+    { PKTBUF_TRACE_ALLOC, 1, 8 },
+    { PKTBUF_TRACE_ALLOC, 2, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 40, 134 },
+    { PKTBUF_TRACE_ALLOC, 41, 8 },
+    { PKTBUF_TRACE_ALLOC, 46, 40 },
+    { PKTBUF_TRACE_ALLOC, 47, 24 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 93 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 42, 22 },
+    { PKTBUF_TRACE_ALLOC, 43, 8 },
+    { PKTBUF_TRACE_ALLOC, 44, 40 },
+    { PKTBUF_TRACE_ALLOC, 45, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 150 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 13, 40 },
+    { PKTBUF_TRACE_ALLOC, 14, 24 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 12, 230 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_ALLOC, 9, 80 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 15, 40 },
+    { PKTBUF_TRACE_ALLOC, 16, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 249 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_ALLOC, 21, 219 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_ALLOC, 34, 262 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 30, 113 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC, 0, 241 },
+    { PKTBUF_TRACE_ALLOC, 1, 8 },
+    { PKTBUF_TRACE_ALLOC, 2, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 42 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 40, 290 },
+    { PKTBUF_TRACE_ALLOC, 41, 8 },
+    { PKTBUF_TRACE_ALLOC, 42, 40 },
+    { PKTBUF_TRACE_ALLOC, 43, 24 },
+    { PKTBUF_TRACE_ALLOC, 44, 29 },
+    { PKTBUF_TRACE_ALLOC, 45, 8 },
+    { PKTBUF_TRACE_ALLOC, 46, 40 },
+    { PKTBUF_TRACE_ALLOC, 47, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 208 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 13, 40 },
+    { PKTBUF_TRACE_ALLOC, 14, 24 },
+    { PKTBUF_TRACE_ALLOC, 12, 193 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 78 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_ALLOC, 9, 254 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 15, 40 },
+    { PKTBUF_TRACE_ALLOC, 16, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_ALLOC, 34, 59 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_ALLOC, 30, 151 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_ALLOC, 21, 280 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 0, 1000 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC, 1, 286 },
+    { PKTBUF_TRACE_ALLOC, 2, 8 },
+    { PKTBUF_TRACE_ALLOC, 28, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 149 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_ALLOC, 40, 198 },
+    { PKTBUF_TRACE_ALLOC, 41, 8 },
+    { PKTBUF_TRACE_ALLOC, 42, 40 },
+    { PKTBUF_TRACE_ALLOC, 43, 24 },
+    { PKTBUF_TRACE_ALLOC, 7, 130 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 13, 40 },
+    { PKTBUF_TRACE_ALLOC, 14, 24 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_ALLOC, 44, 138 },
+    { PKTBUF_TRACE_ALLOC, 45, 8 },
+    { PKTBUF_TRACE_ALLOC, 46, 40 },
+    { PKTBUF_TRACE_ALLOC, 47, 24 },
+    { PKTBUF_TRACE_ALLOC, 12, 118 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 30 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_ALLOC, 9, 257 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 15, 40 },
+    { PKTBUF_TRACE_ALLOC, 16, 24 },
+    { PKTBUF_TRACE_ALLOC, 34, 244 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_ALLOC, 21, 202 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_ALLOC, 30, 132 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 1, 120 },
+    { PKTBUF_TRACE_ALLOC, 2, 8 },
+    { PKTBUF_TRACE_ALLOC, 28, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 261 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_ALLOC, 40, 59 },
+    { PKTBUF_TRACE_ALLOC, 41, 8 },
+    { PKTBUF_TRACE_ALLOC, 42, 40 },
+    { PKTBUF_TRACE_ALLOC, 43, 24 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 214 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 13, 40 },
+    { PKTBUF_TRACE_ALLOC, 14, 24 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_ALLOC, 44, 260 },
+    { PKTBUF_TRACE_ALLOC, 45, 8 },
+    { PKTBUF_TRACE_ALLOC, 46, 40 },
+    { PKTBUF_TRACE_ALLOC, 47, 24 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_ALLOC, 12, 186 },
+    { PKTBUF_TRACE_ALLOC, 17, 8 },
+    { PKTBUF_TRACE_ALLOC, 18, 40 },
+    { PKTBUF_TRACE_ALLOC, 19, 24 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 25, 253 },
+    { PKTBUF_TRACE_ALLOC, 26, 8 },
+    { PKTBUF_TRACE_ALLOC, 27, 40 },
+    { PKTBUF_TRACE_ALLOC, 29, 24 },
+    { PKTBUF_TRACE_ALLOC, 9, 97 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 15, 40 },
+    { PKTBUF_TRACE_ALLOC, 16, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_ALLOC, 30, 30 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_ALLOC, 34, 90 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC, 21, 195 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 24, 24 },
+    { PKTBUF_TRACE_ALLOC, 3, 26 },
+    { PKTBUF_TRACE_ALLOC, 4, 8 },
+    { PKTBUF_TRACE_ALLOC, 5, 40 },
+    { PKTBUF_TRACE_ALLOC, 6, 24 },
+    { PKTBUF_TRACE_ALLOC_LONG, 1, 640 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 2, 238 },
+    { PKTBUF_TRACE_ALLOC, 28, 8 },
+    { PKTBUF_TRACE_ALLOC, 39, 40 },
+    { PKTBUF_TRACE_ALLOC, 7, 24 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_ALLOC, 8, 124 },
+    { PKTBUF_TRACE_ALLOC, 13, 8 },
+    { PKTBUF_TRACE_ALLOC, 14, 40 },
+    { PKTBUF_TRACE_ALLOC, 40, 24 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 41, 800 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_ALLOC, 42, 148 },
+    { PKTBUF_TRACE_ALLOC, 43, 8 },
+    { PKTBUF_TRACE_ALLOC, 44, 40 },
+    { PKTBUF_TRACE_ALLOC, 45, 24 },
+    { PKTBUF_TRACE_ALLOC, 46, 47 },
+    { PKTBUF_TRACE_ALLOC, 47, 8 },
+    { PKTBUF_TRACE_ALLOC, 9, 40 },
+    { PKTBUF_TRACE_ALLOC, 10, 24 },
+    { PKTBUF_TRACE_ALLOC, 15, 250 },
+    { PKTBUF_TRACE_ALLOC, 16, 8 },
+    { PKTBUF_TRACE_ALLOC, 12, 40 },
+    { PKTBUF_TRACE_ALLOC, 17, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 18, 272 },
+    { PKTBUF_TRACE_ALLOC, 19, 8 },
+    { PKTBUF_TRACE_ALLOC, 20, 40 },
+    { PKTBUF_TRACE_ALLOC, 25, 24 },
+    { PKTBUF_TRACE_ALLOC, 26, 284 },
+    { PKTBUF_TRACE_ALLOC, 27, 8 },
+    { PKTBUF_TRACE_ALLOC, 29, 40 },
+    { PKTBUF_TRACE_ALLOC, 30, 24 },
+    { PKTBUF_TRACE_FREE, 11, 0 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_ALLOC, 31, 109 },
+    { PKTBUF_TRACE_ALLOC, 32, 8 },
+    { PKTBUF_TRACE_ALLOC, 33, 40 },
+    { PKTBUF_TRACE_ALLOC, 3, 24 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_ALLOC, 4, 104 },
+    { PKTBUF_TRACE_ALLOC, 5, 8 },
+    { PKTBUF_TRACE_ALLOC, 6, 40 },
+    { PKTBUF_TRACE_ALLOC, 34, 24 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_ALLOC, 35, 300 },
+    { PKTBUF_TRACE_ALLOC, 36, 8 },
+    { PKTBUF_TRACE_ALLOC, 37, 40 },
+    { PKTBUF_TRACE_ALLOC, 21, 24 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 22, 70 },
+    { PKTBUF_TRACE_ALLOC, 23, 8 },
+    { PKTBUF_TRACE_ALLOC, 24, 40 },
+    { PKTBUF_TRACE_ALLOC, 2, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 143 },
+    { PKTBUF_TRACE_ALLOC, 28, 8 },
+    { PKTBUF_TRACE_ALLOC, 39, 40 },
+    { PKTBUF_TRACE_ALLOC, 8, 24 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 13, 66 },
+    { PKTBUF_TRACE_ALLOC, 14, 8 },
+    { PKTBUF_TRACE_ALLOC, 40, 40 },
+    { PKTBUF_TRACE_ALLOC, 9, 24 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_ALLOC, 10, 48 },
+    { PKTBUF_TRACE_ALLOC, 42, 8 },
+    { PKTBUF_TRACE_ALLOC, 43, 40 },
+    { PKTBUF_TRACE_ALLOC, 44, 24 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_ALLOC, 45, 157 },
+    { PKTBUF_TRACE_ALLOC, 46, 8 },
+    { PKTBUF_TRACE_ALLOC, 47, 40 },
+    { PKTBUF_TRACE_ALLOC, 11, 24 },
+    { PKTBUF_TRACE_ALLOC, 12, 275 },
+    { PKTBUF_TRACE_ALLOC, 15, 8 },
+    { PKTBUF_TRACE_ALLOC, 16, 40 },
+    { PKTBUF_TRACE_ALLOC, 17, 24 },
+    { PKTBUF_TRACE_FREE, 11, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 26, 119 },
+    { PKTBUF_TRACE_ALLOC, 27, 8 },
+    { PKTBUF_TRACE_ALLOC, 29, 40 },
+    { PKTBUF_TRACE_ALLOC, 30, 24 },
+    { PKTBUF_TRACE_ALLOC, 18, 229 },
+    { PKTBUF_TRACE_ALLOC, 19, 8 },
+    { PKTBUF_TRACE_ALLOC, 20, 40 },
+    { PKTBUF_TRACE_ALLOC, 25, 24 },
+    { PKTBUF_TRACE_ALLOC, 4, 177 },
+    { PKTBUF_TRACE_ALLOC, 5, 8 },
+    { PKTBUF_TRACE_ALLOC, 6, 40 },
+    { PKTBUF_TRACE_ALLOC, 21, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_ALLOC, 34, 235 },
+    { PKTBUF_TRACE_ALLOC, 35, 8 },
+    { PKTBUF_TRACE_ALLOC, 36, 40 },
+    { PKTBUF_TRACE_ALLOC, 37, 24 },
+    { PKTBUF_TRACE_ALLOC, 3, 78 },
+    { PKTBUF_TRACE_ALLOC, 31, 8 },
+    { PKTBUF_TRACE_ALLOC, 32, 40 },
+    { PKTBUF_TRACE_ALLOC, 33, 24 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 7, 203 },
+    { PKTBUF_TRACE_ALLOC, 8, 8 },
+    { PKTBUF_TRACE_ALLOC, 28, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_ALLOC, 9, 255 },
+    { PKTBUF_TRACE_ALLOC, 13, 8 },
+    { PKTBUF_TRACE_ALLOC, 14, 40 },
+    { PKTBUF_TRACE_ALLOC, 40, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 2, 219 },
+    { PKTBUF_TRACE_ALLOC, 10, 8 },
+    { PKTBUF_TRACE_ALLOC, 22, 40 },
+    { PKTBUF_TRACE_ALLOC, 23, 24 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_ALLOC, 24, 130 },
+    { PKTBUF_TRACE_ALLOC, 42, 8 },
+    { PKTBUF_TRACE_ALLOC, 43, 40 },
+    { PKTBUF_TRACE_ALLOC, 44, 24 },
+    { PKTBUF_TRACE_ALLOC, 11, 279 },
+    { PKTBUF_TRACE_ALLOC, 45, 8 },
+    { PKTBUF_TRACE_ALLOC, 46, 40 },
+    { PKTBUF_TRACE_ALLOC, 47, 24 },
+    { PKTBUF_TRACE_FREE, 24, 0 },
+    { PKTBUF_TRACE_FREE, 38, 0 },
+    { PKTBUF_TRACE_FREE, 42, 0 },
+    { PKTBUF_TRACE_FREE, 43, 0 },
+    { PKTBUF_TRACE_FREE, 44, 0 },
+    { PKTBUF_TRACE_ALLOC, 12, 116 },
+    { PKTBUF_TRACE_ALLOC, 15, 8 },
+    { PKTBUF_TRACE_ALLOC, 16, 40 },
+    { PKTBUF_TRACE_ALLOC, 17, 24 },
+    { PKTBUF_TRACE_ALLOC, 18, 203 },
+    { PKTBUF_TRACE_ALLOC, 19, 8 },
+    { PKTBUF_TRACE_ALLOC, 20, 40 },
+    { PKTBUF_TRACE_ALLOC, 25, 24 },
+    { PKTBUF_TRACE_FREE, 18, 0 },
+    { PKTBUF_TRACE_FREE, 19, 0 },
+    { PKTBUF_TRACE_FREE, 20, 0 },
+    { PKTBUF_TRACE_FREE, 25, 0 },
+    { PKTBUF_TRACE_ALLOC_LONG, 26, 1280 },
+    { PKTBUF_TRACE_FREE, 11, 0 },
+    { PKTBUF_TRACE_FREE, 45, 0 },
+    { PKTBUF_TRACE_FREE, 46, 0 },
+    { PKTBUF_TRACE_FREE, 47, 0 },
+    { PKTBUF_TRACE_ALLOC, 27, 185 },
+    { PKTBUF_TRACE_ALLOC, 29, 8 },
+    { PKTBUF_TRACE_ALLOC, 30, 40 },
+    { PKTBUF_TRACE_ALLOC, 34, 24 },
+    { PKTBUF_TRACE_FREE, 12, 0 },
+    { PKTBUF_TRACE_FREE, 15, 0 },
+    { PKTBUF_TRACE_FREE, 16, 0 },
+    { PKTBUF_TRACE_FREE, 17, 0 },
+    { PKTBUF_TRACE_ALLOC, 35, 278 },
+    { PKTBUF_TRACE_ALLOC, 36, 8 },
+    { PKTBUF_TRACE_ALLOC, 37, 40 },
+    { PKTBUF_TRACE_ALLOC, 4, 24 },
+    { PKTBUF_TRACE_ALLOC, 5, 133 },
+    { PKTBUF_TRACE_ALLOC, 6, 8 },
+    { PKTBUF_TRACE_ALLOC, 21, 40 },
+    { PKTBUF_TRACE_ALLOC, 0, 24 },
+    { PKTBUF_TRACE_FREE, 0, 0 },
+    { PKTBUF_TRACE_FREE, 5, 0 },
+    { PKTBUF_TRACE_FREE, 6, 0 },
+    { PKTBUF_TRACE_FREE, 21, 0 },
+    { PKTBUF_TRACE_ALLOC, 3, 59 },
+    { PKTBUF_TRACE_ALLOC, 7, 8 },
+    { PKTBUF_TRACE_ALLOC, 8, 40 },
+    { PKTBUF_TRACE_ALLOC, 28, 24 },
+    { PKTBUF_TRACE_FREE, 3, 0 },
+    { PKTBUF_TRACE_FREE, 4, 0 },
+    { PKTBUF_TRACE_FREE, 7, 0 },
+    { PKTBUF_TRACE_FREE, 8, 0 },
+    { PKTBUF_TRACE_FREE, 27, 0 },
+    { PKTBUF_TRACE_FREE, 28, 0 },
+    { PKTBUF_TRACE_FREE, 29, 0 },
+    { PKTBUF_TRACE_FREE, 30, 0 },
+    { PKTBUF_TRACE_FREE, 34, 0 },
+    { PKTBUF_TRACE_FREE, 35, 0 },
+    { PKTBUF_TRACE_FREE, 36, 0 },
+    { PKTBUF_TRACE_FREE, 37, 0 },
+    { PKTBUF_TRACE_ALLOC, 31, 108 },
+    { PKTBUF_TRACE_ALLOC, 32, 8 },
+    { PKTBUF_TRACE_ALLOC, 33, 40 },
+    { PKTBUF_TRACE_ALLOC, 39, 24 },
+    { PKTBUF_TRACE_FREE, 31, 0 },
+    { PKTBUF_TRACE_FREE, 32, 0 },
+    { PKTBUF_TRACE_FREE, 33, 0 },
+    { PKTBUF_TRACE_FREE, 39, 0 },
+    { PKTBUF_TRACE_ALLOC, 2, 232 },
+    { PKTBUF_TRACE_ALLOC, 9, 8 },
+    { PKTBUF_TRACE_ALLOC, 10, 40 },
+    { PKTBUF_TRACE_ALLOC, 13, 24 },
+    { PKTBUF_TRACE_ALLOC, 14, 223 },
+    { PKTBUF_TRACE_ALLOC, 22, 8 },
+    { PKTBUF_TRACE_ALLOC, 23, 40 },
+    { PKTBUF_TRACE_ALLOC, 40, 24 },
+    { PKTBUF_TRACE_FREE, 2, 0 },
+    { PKTBUF_TRACE_FREE, 9, 0 },
+    { PKTBUF_TRACE_FREE, 10, 0 },
+    { PKTBUF_TRACE_FREE, 13, 0 },
+    { PKTBUF_TRACE_FREE, 14, 0 },
+    { PKTBUF_TRACE_FREE, 22, 0 },
+    { PKTBUF_TRACE_FREE, 23, 0 },
+    { PKTBUF_TRACE_FREE, 40, 0 },
+    { PKTBUF_TRACE_FREE, 41, 0 },
+    { PKTBUF_TRACE_FREE, 1, 0 },
+    { PKTBUF_TRACE_FREE, 26, 0 },
+};
+
+const size_t pktbuf_trace_numof = ARRAY_SIZE(pktbuf_trace);
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer allocation trace format
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef PKTBUF_TRACE_H
+#define PKTBUF_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of packet slots a trace may refer to
+ */
+#define PKTBUF_TRACE_SLOTS      (48U)
+
+/**
+ * @brief   Trace operations
+ */
+enum {
+    PKTBUF_TRACE_ALLOC,         /**< short-lived allocation into slot */
+    PKTBUF_TRACE_ALLOC_LONG,    /**< long-lived allocation into slot */
+    PKTBUF_TRACE_FREE,          /**< release of the packet in slot */
+};
+
+/**
+ * @brief   A single recorded packet buffer operation
+ */
+typedef struct {
+    uint8_t op;                 /**< operation */
+    uint8_t slot;               /**< slot of the packet */
+    uint16_t size;              /**< data size for allocations */
+} pktbuf_trace_entry_t;
+
+/**
+ * @brief   The trace to replay
+ */
+extern const pktbuf_trace_entry_t pktbuf_trace[];
+
+/**
+ * @brief   Number of entries in @ref pktbuf_trace
+ */
+extern const size_t pktbuf_trace_numof;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKTBUF_TRACE_H */
+/** @} */
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"replaying \d+ entries, best-fit: \d")
+    child.expect(r"{ \"result\" : \d+, \"failed\" : \d+ }")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
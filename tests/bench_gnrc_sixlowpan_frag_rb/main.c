@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN reassembly buffer benchmark
+ *
+ * Feeds the fragments of datagrams from several senders interleaved into the
+ * reassembly buffer and measures how long it takes to reassemble them.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/sixlowpan.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUNDS
+#define NUMOF_ROUNDS        (500U)
+#endif
+
+#define DATAGRAM_SIZE       (348U)
+#define FRAG_PAYLOAD_SIZE   (96U)
+#define NUMOF_FRAGS         ((DATAGRAM_SIZE + FRAG_PAYLOAD_SIZE - 1) / \
+                             FRAG_PAYLOAD_SIZE)
+#define L2ADDR_LEN          (8U)
+
+static const unsigned _senders[] = { 4, 8, 16 };
+
+static uint8_t _datagram[DATAGRAM_SIZE];
+static uint8_t _frag[sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_SIZE];
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[L2ADDR_LEN];
+    uint8_t dst[L2ADDR_LEN];
+} _netif_hdr;
+
+static gnrc_sixlowpan_frag_rb_t *_add_frag(unsigned sender, uint16_t tag,
+                                           unsigned idx)
+{
+    unsigned offset = idx * FRAG_PAYLOAD_SIZE;
+    size_t frag_size = DATAGRAM_SIZE - offset;
+    size_t hdr_size;
+    gnrc_pktsnip_t *pkt;
+    uint8_t src[L2ADDR_LEN] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00 };
+
+    if (frag_size > FRAG_PAYLOAD_SIZE) {
+        frag_size = FRAG_PAYLOAD_SIZE;
+    }
+    if (idx == 0) {
+        sixlowpan_frag_t *f = (sixlowpan_frag_t *)_frag;
+
+        f->disp_size = byteorder_htons(DATAGRAM_SIZE);
+        f->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        f->tag = byteorder_htons(tag);
+        /* first fragment carries the uncompressed IPv6 header */
+        _frag[sizeof(*f)] = SIXLOWPAN_UNCOMP;
+        hdr_size = sizeof(*f) + 1;
+    }
+    else {
+        sixlowpan_frag_n_t *f = (sixlowpan_frag_n_t *)_frag;
+
+        f->disp_size = byteorder_htons(DATAGRAM_SIZE);
+        f->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        f->tag = byteorder_htons(tag);
+        f->offset = offset / 8;
+        hdr_size = sizeof(*f);
+    }
+    memcpy(&_frag[hdr_size], &_datagram[offset], frag_size);
+
+    src[6] = sender >> 8;
+    src[7] = sender & 0xff;
+    gnrc_netif_hdr_set_src_addr(&_netif_hdr.hdr, src, sizeof(src));
+
+    pkt = gnrc_pktbuf_add(NULL, _frag, hdr_size + frag_size,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    /* pkt is released by gnrc_sixlowpan_frag_rb_add() */
+    return gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt, offset, 0);
+}
+
+static uint32_t _run(unsigned senders, uint32_t *failed)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned round = 0; round < NUMOF_ROUNDS; round++) {
+        uint16_t tag = round;
+
+        /* deliver the fragments of all senders interleaved, last fragment
+         * first to have the buffer entry span the whole datagram early */
+        for (int idx = NUMOF_FRAGS - 1; idx >= 0; idx--) {
+            for (unsigned s = 0; s < senders; s++) {
+                gnrc_sixlowpan_frag_rb_t *entry = _add_frag(s, tag, idx);
+
+                if (entry == NULL) {
+                    (*failed)++;
+                }
+                /* the complete datagram has no receivers and is released */
+                else if ((gnrc_sixlowpan_frag_rb_dispatch_when_complete(
+                                entry, &_netif_hdr.hdr) > 0) != (idx == 0)) {
+                    (*failed)++;
+                }
+            }
+        }
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    uint32_t failed = 0;
+    const uint8_t dst[L2ADDR_LEN] = {
+        0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff
+    };
+
+    printf("main starting, %u rounds, hash: %u\n", NUMOF_ROUNDS,
+           IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH));
+
+    gnrc_pktbuf_init();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, L2ADDR_LEN, L2ADDR_LEN);
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, dst, sizeof(dst));
+    memset(_datagram, 0x54, sizeof(_datagram));
+    /* IPv6 header with a hop limit, see tests/gnrc_sixlowpan_frag */
+    _datagram[0] = 0x60;
+    _datagram[4] = (DATAGRAM_SIZE - 40) >> 8;
+    _datagram[5] = (DATAGRAM_SIZE - 40) & 0xff;
+    _datagram[6] = 0x3a;
+    _datagram[7] = 0x40;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_senders); i++) {
+        uint32_t time = _run(_senders[i], &failed);
+
+        printf("{ \"senders\" : %u, \"result\" : %" PRIu32 " }\n",
+               _senders[i], time);
+    }
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
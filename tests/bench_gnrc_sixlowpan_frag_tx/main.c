@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN fragmentation TX benchmark
+ *
+ * Sends datagrams that need fragmentation to a dummy IEEE 802.15.4 device
+ * and counts the frames the device got within the test duration.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef DATAGRAM_SIZE
+#define DATAGRAM_SIZE       (1024U)
+#endif
+
+#define MAX_FRAME_SIZE      (102U)
+
+static const uint8_t _local_eui64[] = {
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01
+};
+static const uint8_t _remote_eui64[] = {
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02
+};
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static uint32_t _frames;
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = MAX_FRAME_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    _frames++;
+    return iolist_size(iolist);
+}
+
+static void _init_interface(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    gnrc_netif_ieee802154_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 GNRC_NETIF_PRIO, "dummy_netif",
+                                 &_dev.netdev.netdev);
+}
+
+static int _send_datagram(void)
+{
+    gnrc_tx_sync_t tx_sync;
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, DATAGRAM_SIZE, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return -1;
+    }
+    memset(pkt->data, 0x5a, pkt->size);
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, _remote_eui64,
+                                     sizeof(_remote_eui64));
+    if (netif_hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+    if (gnrc_tx_sync_append(pkt, &tx_sync) != 0) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    gnrc_tx_sync(&tx_sync);
+    return 0;
+}
+
+int main(void)
+{
+    ztimer_t timer = { .callback = _timer_callback };
+    uint32_t datagrams = 0;
+    uint32_t failed = 0;
+
+    printf("main starting, datagram size: %u, batch: %u\n", DATAGRAM_SIZE,
+           IS_USED(MODULE_GNRC_NETIF_BATCH));
+
+    _init_interface();
+
+    _frames = 0;
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+    while (!_flag) {
+        if (_send_datagram() < 0) {
+            failed++;
+        }
+        else {
+            datagrams++;
+        }
+    }
+
+    printf("{ \"result\" : %" PRIu32 ", \"datagrams\" : %" PRIu32
+           ", \"failed\" : %" PRIu32 " }\n", _frames, datagrams, failed);
+
+    return 0;
+}
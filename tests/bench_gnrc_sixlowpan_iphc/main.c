@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN IPHC benchmark
+ *
+ * Sends small IPv6 packets of a number of flows to a dummy IEEE 802.15.4
+ * device and measures how long it takes to compress and send them.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_PACKETS
+#define NUMOF_PACKETS       (2000U)
+#endif
+
+#define PAYLOAD_SIZE        (32U)
+#define MAX_FRAME_SIZE      (102U)
+
+static const unsigned _flows[] = { 1, 2, 4 };
+static const uint8_t _local_eui64[] = {
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01
+};
+static const ipv6_addr_t _prefix = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    }
+};
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static uint32_t _frames;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = MAX_FRAME_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    _frames++;
+    return iolist_size(iolist);
+}
+
+static void _init_interface(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    gnrc_netif_ieee802154_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 GNRC_NETIF_PRIO, "dummy_netif",
+                                 &_dev.netdev.netdev);
+}
+
+static int _send_packet(unsigned flow)
+{
+    gnrc_tx_sync_t tx_sync;
+    gnrc_pktsnip_t *pkt, *hdr;
+    ipv6_hdr_t *ipv6_hdr;
+    ipv6_addr_t src = _prefix, dst = IPV6_ADDR_UNSPECIFIED;
+    uint8_t remote_eui64[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0x00 };
+
+    /* global source address compressed with context 0, link-local
+     * destination address derived from the link-layer destination */
+    memcpy(&src.u8[8], _local_eui64, sizeof(_local_eui64));
+    src.u8[8] ^= 0x02;
+    remote_eui64[7] = flow;
+    ipv6_addr_set_link_local_prefix(&dst);
+    memcpy(&dst.u8[8], remote_eui64, sizeof(remote_eui64));
+    dst.u8[8] ^= 0x02;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return -1;
+    }
+    memset(pkt->data, 0x5a, pkt->size);
+    hdr = gnrc_ipv6_hdr_build(pkt, &src, &dst);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    pkt = hdr;
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->len = byteorder_htons(PAYLOAD_SIZE);
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = 64;
+    hdr = gnrc_netif_hdr_build(NULL, 0, remote_eui64, sizeof(remote_eui64));
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    if (gnrc_tx_sync_append(pkt, &tx_sync) != 0) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    gnrc_tx_sync(&tx_sync);
+    return 0;
+}
+
+static uint32_t _run(unsigned flows, uint32_t *failed)
+{
+    uint32_t frames = _frames;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t time;
+
+    for (unsigned i = 0; i < NUMOF_PACKETS; i++) {
+        if (_send_packet(i % flows) < 0) {
+            (*failed)++;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    /* the interface might have sent packets of its own in between */
+    frames = _frames - frames;
+    if (frames < NUMOF_PACKETS) {
+        *failed += NUMOF_PACKETS - frames;
+    }
+    return time;
+}
+
+int main(void)
+{
+    uint32_t failed = 0;
+
+    printf("main starting, %u packets, cache: %u\n", NUMOF_PACKETS,
+           IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE));
+
+    _init_interface();
+    gnrc_sixlowpan_ctx_update(0, &_prefix, 64, UINT16_MAX, true);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_flows); i++) {
+        uint32_t time = _run(_flows[i], &failed);
+
+        printf("{ \"flows\" : %u, \"result\" : %" PRIu32 " }\n",
+               _flows[i], time);
+    }
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_tcp goodput benchmark
+ *
+ * Sends data to a TCP server via a network interface whose driver drops a
+ * configurable share of the outgoing frames.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "iolist.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tcp.h"
+#include "random.h"
+#include "shell.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef CHUNK_SIZE
+#define CHUNK_SIZE          (4096U)
+#endif
+
+#ifndef SEND_TIMEOUT_MS
+#define SEND_TIMEOUT_MS     (30000U)
+#endif
+
+#define MAIN_QUEUE_SIZE     (8)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static uint8_t _chunk[CHUNK_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static netdev_driver_t _driver;
+static const netdev_driver_t *_parent;
+static unsigned _loss;
+static unsigned _dropped;
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    if (random_uint32_range(0, 100) < _loss) {
+        _dropped++;
+        return iolist_size(iolist);
+    }
+    return _parent->send(dev, iolist);
+}
+
+static int _goodput_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t start, time;
+    size_t left;
+    int res;
+
+    if (argc < 4) {
+        printf("usage: %s <[addr%%netif]:port> <bytes> <loss in %%>\n",
+               argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("error: invalid endpoint");
+        return 1;
+    }
+    left = strtoul(argv[2], NULL, 10);
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("error: open failed (%d)\n", res);
+        return 1;
+    }
+
+    /* send the buffer in two parts, so the scatter-gather path is used */
+    iolist_t second = {
+        .iol_base = _chunk + CHUNK_SIZE / 2,
+        .iol_len = CHUNK_SIZE - CHUNK_SIZE / 2,
+    };
+    iolist_t first = {
+        .iol_next = &second,
+        .iol_base = _chunk,
+        .iol_len = CHUNK_SIZE / 2,
+    };
+
+    size_t bytes = left;
+    _dropped = 0;
+    _loss = atoi(argv[3]);
+    start = ztimer_now(ZTIMER_USEC);
+    while (left > 0) {
+        if (left < CHUNK_SIZE) {
+            first.iol_len = (left < CHUNK_SIZE / 2) ? left : CHUNK_SIZE / 2;
+            second.iol_len = left - first.iol_len;
+        }
+        size_t len = iolist_size(&first);
+
+        res = gnrc_tcp_send_iolist(&_tcb, &first, SEND_TIMEOUT_MS);
+        if (res != (int)len) {
+            res = (res < 0) ? res : -ETIMEDOUT;
+            break;
+        }
+        left -= len;
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    _loss = 0;
+    gnrc_tcp_close(&_tcb);
+
+    if (res < 0) {
+        printf("error: send failed (%d)\n", res);
+        return 1;
+    }
+    printf("{ \"bytes\" : %" PRIu32 ", \"loss\" : %s, \"dropped\" : %u, "
+           "\"sack\" : %u, \"time\" : %" PRIu32 ", \"goodput\" : %" PRIu32 " }\n",
+           (uint32_t)bytes, argv[3], _dropped, IS_USED(MODULE_GNRC_TCP_SACK),
+           time, (uint32_t)((uint64_t)bytes * US_PER_SEC / time));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "goodput", "send data via TCP and measure the goodput", _goodput_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        _chunk[i] = i;
+    }
+
+    /* let the driver of the interface drop frames */
+    _parent = netif->dev->driver;
+    _driver = *_parent;
+    _driver.send = _send;
+    netif->dev->driver = &_driver;
+
+    printf("gnrc_tcp goodput benchmark, SACK %s\n",
+           IS_USED(MODULE_GNRC_TCP_SACK) ? "on" : "off");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
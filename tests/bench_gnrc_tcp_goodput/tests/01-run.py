@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import sys
+import threading
+from testrunner import run
+
+BYTES = 100000
+LOSS = (0, 2, 5, 10)
+
+
+def _host_address():
+    # Use the bridge if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search('master (.*) state',
+                       os.popen('bridge link show dev {}'.format(tap)).read())
+    interface = bridge.group(1).strip() if bridge else tap
+    result = os.popen('ip addr show dev {} scope link'.format(interface)).read()
+    return re.search('inet6 (.*)/64', result).group(1).strip()
+
+
+def _receive(listen_sock, received):
+    sock, _ = listen_sock.accept()
+    with sock:
+        while True:
+            data = sock.recv(4096)
+            if not data:
+                break
+            received[0] += len(data)
+
+
+def testfunc(child):
+    child.expect(r"gnrc_tcp goodput benchmark, SACK (on|off)")
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    iface = child.match.group(1).strip()
+    addr = _host_address()
+
+    for loss in LOSS:
+        with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as listen_sock:
+            listen_sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+            listen_sock.bind(('::', 0))
+            listen_sock.listen(1)
+            port = listen_sock.getsockname()[1]
+            received = [0]
+            receiver = threading.Thread(target=_receive,
+                                        args=(listen_sock, received))
+            receiver.start()
+
+            child.sendline('goodput [{}%{}]:{} {} {}'.format(addr, iface, port,
+                                                            BYTES, loss))
+            child.expect(r'{ "bytes" : \d+, "loss" : \d+, "dropped" : \d+, '
+                         r'"sack" : \d, "time" : \d+, "goodput" : \d+ }',
+                         timeout=120)
+            receiver.join()
+            assert received[0] == BYTES
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
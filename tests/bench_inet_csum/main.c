@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the Internet Checksum calculation
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_BYTES
+#define NUMOF_BYTES     (64U * 1024U)
+#endif
+
+#define SIZE_MAX_       (1280U)
+
+/* one spare byte for unaligned access */
+static uint32_t _buf[(SIZE_MAX_ + 1 + 3) / 4];
+static volatile uint16_t _sink;
+
+static const unsigned _sizes[] = { 8, 48, 128, 1280 };
+
+/* 16 bits at a time, the way inet_csum() used to calculate the checksum */
+static uint16_t _bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1U); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static uint16_t _aligned(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    return inet_csum(sum, buf, len);
+}
+
+static uint16_t _unaligned(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    return inet_csum(sum, buf + 1, len);
+}
+
+static uint16_t _reference(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    return _bytewise(sum, buf + 1, len);
+}
+
+static void _bench(const char *name,
+                   uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t),
+                   unsigned size)
+{
+    const uint8_t *buf = (const uint8_t *)_buf;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < NUMOF_BYTES; n += size) {
+        _sink = csum(n, buf, size);
+    }
+    printf("{ \"%s\" : %u, \"result\" : %" PRIu32 " }\n", name, size,
+           ztimer_now(ZTIMER_USEC) - start);
+}
+
+int main(void)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+    bool success = true;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        buf[i] = 0xa5 ^ (i * 13);
+    }
+
+    /* verify the results for all sizes up to the largest one */
+    for (unsigned len = 0; len <= SIZE_MAX_; len++) {
+        success &= (_aligned(0x1234, buf, len) == _bytewise(0x1234, buf, len));
+        success &= (_unaligned(0x1234, buf, len) ==
+                    _reference(0x1234, buf, len));
+    }
+
+    printf("checksumming %u bytes\n", NUMOF_BYTES);
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _bench("bytewise", _bytewise, _sizes[i]);
+        _bench("inet_csum", _aligned, _sizes[i]);
+        _bench("inet_csum_unaligned", _unaligned, _sizes[i]);
+    }
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+SIZES = (8, 48, 128, 1280)
+VARIANTS = ("bytewise", "inet_csum", "inet_csum_unaligned")
+
+
+def testfunc(child):
+    child.expect(r"checksumming \d+ bytes\r\n")
+    for size in SIZES:
+        for variant in VARIANTS:
+            child.expect_exact('{{ "{}" : {}, "result" : '.format(variant, size))
+            child.expect(r"\d+ }\r\n")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -27,13 +27,33 @@
 
 #include "msg.h"
 #include "xtimer.h"
+#if IS_USED(MODULE_MSG_BUF)
+#include "msg_buf.h"
+#endif
 
 #ifndef TEST_DURATION_US
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef BATCH_SIZE
+#define BATCH_SIZE          (8U)
+#endif
+
+#define MSG_TYPE_BUF        (0x4255)
+#define BUF_SIZE            (128U)
+#define BUF_NUMOF           (4U)
+
 static char _stack[THREAD_STACKSIZE_MAIN];
 
+#if IS_ACTIVE(BENCH_MSG_MANY) || IS_USED(MODULE_MSG_BUF)
+static msg_t _queue[BATCH_SIZE];
+static volatile bool _many;
+#endif
+#if IS_USED(MODULE_MSG_BUF)
+static MSG_BUF_POOL_MEM(_pool_mem, BUF_SIZE, BUF_NUMOF);
+static msg_buf_pool_t _pool;
+#endif
+
 static void _timer_callback(void *flag)
 {
     atomic_flag_clear(flag);
@@ -43,14 +63,70 @@ static void *_second_thread(void *arg)
 {
     (void)arg;
 
+#if IS_ACTIVE(BENCH_MSG_MANY) || IS_USED(MODULE_MSG_BUF)
+    msg_init_queue(_queue, BATCH_SIZE);
+
+    while (1) {
+        msg_t test[BATCH_SIZE];
+        int n = _many ? msg_receive_many(test, BATCH_SIZE)
+                      : msg_receive(test);
+
+        for (int i = 0; IS_USED(MODULE_MSG_BUF) && (i < n); i++) {
+            if (test[i].type == MSG_TYPE_BUF) {
+                msg_buf_free(msg_buf_get(&test[i]));
+            }
+        }
+    }
+#else
     while (1) {
         msg_t test;
         msg_receive(&test);
     }
+#endif
 
     return NULL;
 }
 
+#if IS_ACTIVE(BENCH_MSG_MANY) || IS_USED(MODULE_MSG_BUF)
+static uint32_t _run(kernel_pid_t other, atomic_flag *flag, xtimer_t *timer,
+                     int (*send)(kernel_pid_t))
+{
+    uint32_t n = 0;
+
+    atomic_flag_test_and_set(flag);
+    xtimer_set(timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(flag)) {
+        n += send(other);
+    }
+    return n;
+}
+#endif
+
+#if IS_ACTIVE(BENCH_MSG_MANY)
+static int _send_many(kernel_pid_t other)
+{
+    msg_t test[BATCH_SIZE];
+
+    return msg_send_many(test, BATCH_SIZE, other);
+}
+#endif
+
+#if IS_USED(MODULE_MSG_BUF)
+static int _send_buf(kernel_pid_t other)
+{
+    msg_t test = { .type = MSG_TYPE_BUF };
+    msg_buf_t *buf = msg_buf_alloc(&_pool);
+
+    if (buf == NULL) {
+        return 0;
+    }
+    /* "fill" the payload, the receiver gets it without copying */
+    *((uint8_t *)msg_buf_data(buf)) = 0;
+    return msg_send_buf(&test, buf, other);
+}
+#endif
+
 int main(void)
 {
     puts("main starting");
@@ -85,5 +161,19 @@ int main(void)
            (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
     puts(" }");
 
+#if IS_ACTIVE(BENCH_MSG_MANY)
+    _many = true;
+    n = _run(other, &flag, &timer, _send_many);
+    _many = false;
+    printf("{ \"send_many\" : %u, \"result\" : %" PRIu32 " }\n",
+           BATCH_SIZE, n);
+#endif
+#if IS_USED(MODULE_MSG_BUF)
+    msg_buf_pool_init(&_pool, _pool_mem, BUF_SIZE, BUF_NUMOF);
+    n = _run(other, &flag, &timer, _send_buf);
+    printf("{ \"msg_buf\" : %u, \"result\" : %" PRIu32 " }\n",
+           BUF_SIZE, n);
+#endif
+
     return 0;
 }
@@ -7,12 +7,17 @@
 # General Public License v2.1. See the file LICENSE in the top level
 # directory for more details.
 
+import os
 import sys
 from testrunner import run
 
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    if os.environ.get("MSG_MANY", "0") == "1":
+        child.expect(r"{ \"send_many\" : \d+, \"result\" : \d+ }")
+    if os.environ.get("MSG_BUF", "0") == "1":
+        child.expect(r"{ \"msg_buf\" : \d+, \"result\" : \d+ }")
 
 
 if __name__ == "__main__":
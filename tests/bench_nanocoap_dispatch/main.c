@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       nanocoap request dispatch benchmark
+ *
+ * Registers 10, 30, 60, and 120 resources and measures how long it takes
+ * coap_tree_handler() to dispatch requests spread over all of them to their
+ * handlers.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "net/nanocoap.h"
+#include "ztimer.h"
+
+#ifndef MAX_RESOURCES
+#define MAX_RESOURCES       (120U)
+#endif
+
+#ifndef NUMOF_REQUESTS
+#define NUMOF_REQUESTS      (10000U)
+#endif
+
+/* resources are /res/<n>/<name> with three digits for n */
+#define PATH_FMT            "/res/%03u/value"
+#define PATH_LEN            sizeof("/res/000/value")
+
+static const unsigned _steps[] = { 10, 30, 60, 120 };
+static char _paths[MAX_RESOURCES][PATH_LEN];
+static coap_resource_t _resources[MAX_RESOURCES];
+static unsigned _handled;
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        void *context)
+{
+    _handled = (uintptr_t)context;
+    return coap_build_reply(pkt, COAP_CODE_204, buf, len, 0);
+}
+
+static void _init_resources(void)
+{
+    /* the format keeps the paths in alphabetical order */
+    for (unsigned i = 0; i < MAX_RESOURCES; i++) {
+        snprintf(_paths[i], sizeof(_paths[i]), PATH_FMT, i);
+        _resources[i].path = _paths[i];
+        _resources[i].methods = COAP_GET | COAP_PUT;
+        _resources[i].handler = _handler;
+        _resources[i].context = (void *)(uintptr_t)i;
+    }
+}
+
+static uint32_t _run(unsigned numof, uint32_t *failed)
+{
+    uint32_t start, duration = 0;
+
+    for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+        uint8_t req[64], resp[32];
+        coap_pkt_t pkt;
+        unsigned idx = i % numof;
+        uint8_t *pos = req;
+
+        /* only the dispatch counts, not building the request */
+        pos += coap_build_hdr((coap_hdr_t *)pos, COAP_TYPE_NON, NULL, 0,
+                              COAP_METHOD_GET, i);
+        pos += coap_opt_put_uri_path(pos, 0, _paths[idx]);
+        if (coap_parse(&pkt, req, pos - req) < 0) {
+            (*failed)++;
+            continue;
+        }
+        _handled = UINT_MAX;
+        start = ztimer_now(ZTIMER_USEC);
+        ssize_t res = coap_tree_handler(&pkt, resp, sizeof(resp), _resources,
+                                        numof);
+
+        duration += ztimer_now(ZTIMER_USEC) - start;
+        if ((res < 0) || (_handled != idx)) {
+            (*failed)++;
+        }
+    }
+    return duration;
+}
+
+int main(void)
+{
+    uint32_t failed = 0;
+
+    printf("main starting, %u requests, bsearch: %u\n", NUMOF_REQUESTS,
+           IS_USED(MODULE_NANOCOAP_RESOURCE_BSEARCH));
+
+    _init_resources();
+    for (unsigned i = 0; i < ARRAY_SIZE(_steps); i++) {
+        if (_steps[i] > MAX_RESOURCES) {
+            break;
+        }
+        printf("{ \"resources\" : %u, \"result\" : %" PRIu32 " }\n",
+               _steps[i], _run(_steps[i], &failed));
+    }
+
+    printf("{ \"failed\" : %" PRIu32 " }\n", failed);
+
+    return 0;
+}
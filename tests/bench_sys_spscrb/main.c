@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark of tsrb and spscrb
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "spscrb.h"
+#include "tsrb.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_BYTES
+#define NUMOF_BYTES     (64U * 1024U)
+#endif
+
+#define RB_SIZE         (128U)
+#define CHUNK_MAX       (64U)
+
+static uint8_t _tsrb_buf[RB_SIZE];
+static uint8_t _spscrb_buf[RB_SIZE];
+static tsrb_t _tsrb = TSRB_INIT(_tsrb_buf);
+static spscrb_t _spscrb = SPSCRB_INIT(_spscrb_buf);
+
+static uint8_t _in[CHUNK_MAX];
+static uint8_t _out[CHUNK_MAX];
+
+static const unsigned _chunks[] = { 1, 4, 16, 64 };
+
+static bool _tsrb_xfer(unsigned chunk)
+{
+    bool ok = true;
+
+    for (unsigned n = 0; n < NUMOF_BYTES; n += chunk) {
+        if (chunk == 1) {
+            tsrb_add_one(&_tsrb, _in[0]);
+            _out[0] = tsrb_get_one(&_tsrb);
+        }
+        else {
+            tsrb_add(&_tsrb, _in, chunk);
+            ok &= (tsrb_get(&_tsrb, _out, chunk) == (int)chunk);
+        }
+    }
+    return ok;
+}
+
+static bool _spscrb_xfer(unsigned chunk)
+{
+    bool ok = true;
+
+    for (unsigned n = 0; n < NUMOF_BYTES; n += chunk) {
+        if (chunk == 1) {
+            spscrb_add_one(&_spscrb, _in[0]);
+            _out[0] = spscrb_get_one(&_spscrb);
+        }
+        else {
+            spscrb_add(&_spscrb, _in, chunk);
+            ok &= (spscrb_get(&_spscrb, _out, chunk) == chunk);
+        }
+    }
+    return ok;
+}
+
+static bool _spscrb_contig_xfer(unsigned chunk)
+{
+    bool ok = true;
+
+    for (unsigned n = 0; n < NUMOF_BYTES; n += chunk) {
+        unsigned done = 0;
+
+        while (done < chunk) {
+            size_t len;
+            uint8_t *dst = spscrb_reserve(&_spscrb, &len);
+            const uint8_t *src;
+
+            len = (len < chunk - done) ? len : chunk - done;
+            memcpy(dst, &_in[done], len);
+            spscrb_commit(&_spscrb, len);
+            src = spscrb_peek_contig(&_spscrb, &len);
+            memcpy(&_out[done], src, len);
+            spscrb_consume(&_spscrb, len);
+            done += len;
+        }
+        ok &= (done == chunk);
+    }
+    return ok;
+}
+
+static bool _check(bool (*xfer)(unsigned), unsigned chunk)
+{
+    memset(_out, 0, sizeof(_out));
+    /* the ringbuffers are empty after every transfer */
+    return xfer(chunk) && !memcmp(_in, _out, chunk) &&
+           tsrb_empty(&_tsrb) && spscrb_empty(&_spscrb);
+}
+
+static void _bench(const char *name, bool (*xfer)(unsigned), unsigned chunk)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    xfer(chunk);
+    printf("{ \"%s\" : %u, \"result\" : %" PRIu32 " }\n", name, chunk,
+           ztimer_now(ZTIMER_USEC) - start);
+}
+
+int main(void)
+{
+    bool success = true;
+
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i + 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        success &= _check(_tsrb_xfer, _chunks[i]);
+        success &= _check(_spscrb_xfer, _chunks[i]);
+        success &= _check(_spscrb_contig_xfer, _chunks[i]);
+    }
+    printf("transferring %u bytes\n", NUMOF_BYTES);
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        _bench("tsrb", _tsrb_xfer, _chunks[i]);
+        _bench("spscrb", _spscrb_xfer, _chunks[i]);
+        _bench("spscrb_contig", _spscrb_contig_xfer, _chunks[i]);
+    }
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+CHUNKS = (1, 4, 16, 64)
+RINGBUFFERS = ("tsrb", "spscrb", "spscrb_contig")
+
+
+def testfunc(child):
+    child.expect(r"transferring \d+ bytes\r\n")
+    for chunk in CHUNKS:
+        for rb in RINGBUFFERS:
+            child.expect_exact('{{ "{}" : {}, "result" : '.format(rb, chunk))
+            child.expect(r"\d+ }\r\n")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -22,9 +22,13 @@
 
 #include "test_utils/expect.h"
 
+#include "kernel_defines.h"
 #include "msg.h"
 #include "thread.h"
 #include "ztimer.h"
+#if IS_USED(MODULE_ZTIMER_HEAP)
+#include "ztimer/heap.h"
+#endif
 
 #ifndef ZTIMER
 #define ZTIMER ZTIMER_MSEC
@@ -91,6 +95,55 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/* simple LCG, so list and heap see the very same sequence of targets */
+static uint32_t _rand(uint32_t *state)
+{
+    *state = *state * 1103515245UL + 12345UL;
+    return *state >> 8;
+}
+
+/*
+ * set and remove 10, 100 and 1000 timers (as far as NUMOF_TIMERS allows) with
+ * scattered targets, so that each operation hits a random queue position
+ */
+static void _bench_scaling(const char *queue)
+{
+    static const unsigned numofs[] = { 10, 100, 1000 };
+    char desc[32];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(numofs); i++) {
+        unsigned numof = numofs[i];
+        uint32_t seed = numof;
+        uint32_t before, diff;
+
+        if (numof > NUMOF_TIMERS) {
+            break;
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < numof; n++) {
+            ztimer_set(ZTIMER, &_timers[n],
+                       BASE + (_rand(&seed) % (numof * SPREAD)));
+        }
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "%s set() %u scattered", queue, numof);
+        _print_result(desc, numof, diff);
+        expect(!_triggers);
+
+        /* 7 is coprime to all numofs, so this removes every timer once */
+        before = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < numof; n++) {
+            _timer_remove((n * 7) % numof);
+        }
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "%s remove() %u scattered", queue, numof);
+        _print_result(desc, numof, diff);
+        expect(!_triggers);
+    }
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -288,6 +341,17 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * test set() / remove() latency depending on the number of timers, for
+     * the list and, if available, for the pairing heap timer queue
+     *
+     */
+    _bench_scaling("list");
+#if IS_USED(MODULE_ZTIMER_HEAP)
+    ztimer_heap_enable(ZTIMER);
+    _bench_scaling("heap");
+#endif
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
     puts("done.");
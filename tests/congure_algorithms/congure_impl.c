@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include "congure_impl.h"
+
+/* the test script relies on these values */
+static const congure_reno_snd_consts_t _reno_consts = {
+    .mss = 100,
+    .init_cwnd = 200,
+    .init_ssthresh = 600,
+    .cwnd_lower = 100,
+    .cwnd_upper = 60000,
+};
+
+static const congure_vegas_snd_consts_t _vegas_consts = {
+    .mss = 100,
+    .init_cwnd = 200,
+    .init_ssthresh = 60000,
+    .cwnd_lower = 100,
+    .cwnd_upper = 60000,
+    .alpha = 2,
+    .beta = 4,
+    .gamma = 1,
+};
+
+static const congure_cubic_snd_consts_t _cubic_consts = {
+    .mss = 100,
+    .init_cwnd = 10000,
+    .init_ssthresh = 60000,
+    .cwnd_lower = 100,
+    .cwnd_upper = 60000,
+    .c = 400,
+    .beta = 717,
+    .fast_convergence = true,
+};
+
+static const congure_cocoa_snd_consts_t _cocoa_consts = {
+    .nstart = 1,
+    .init_rto = 2000,
+};
+
+int congure_test_snd_setup(congure_test_snd_t *c, unsigned id)
+{
+    switch (id) {
+        case CONGURE_IMPL_RENO:
+            congure_reno_snd_setup(&c->reno, &_reno_consts);
+            break;
+        case CONGURE_IMPL_VEGAS:
+            congure_vegas_snd_setup(&c->vegas, &_vegas_consts);
+            break;
+        case CONGURE_IMPL_CUBIC:
+            congure_cubic_snd_setup(&c->cubic, &_cubic_consts);
+            break;
+        case CONGURE_IMPL_COCOA:
+            congure_cocoa_snd_setup(&c->cocoa, &_cocoa_consts);
+            break;
+        default:
+            return -1;
+    }
+    c->impl = id;
+    return 0;
+}
+
+/** @} */
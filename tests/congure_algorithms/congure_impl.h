@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef CONGURE_IMPL_H
+#define CONGURE_IMPL_H
+
+#include "congure/cocoa.h"
+#include "congure/cubic.h"
+#include "congure/reno.h"
+#include "congure/vegas.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   IDs for `cong_setup`, selecting the implementation under test
+ */
+enum {
+    CONGURE_IMPL_RENO = 0,
+    CONGURE_IMPL_VEGAS,
+    CONGURE_IMPL_CUBIC,
+    CONGURE_IMPL_COCOA,
+    CONGURE_IMPL_NUMOF,
+};
+
+typedef struct {
+    union {
+        congure_snd_t super;
+        congure_reno_snd_t reno;
+        congure_vegas_snd_t vegas;
+        congure_cubic_snd_t cubic;
+        congure_cocoa_snd_t cocoa;
+    };
+    unsigned impl;
+} congure_test_snd_t;
+
+int congure_test_snd_setup(congure_test_snd_t *c, unsigned id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONGURE_IMPL_H */
+/** @} */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <string.h>
+
+#include "congure/test.h"
+#include "fmt.h"
+#include "shell.h"
+
+#include "congure_impl.h"
+
+static int _json_statham(int argc, char **argv);
+static int _cocoa_rto(int argc, char **argv);
+static int _cocoa_backoff(int argc, char **argv);
+
+static congure_test_snd_t _congure_state;
+static const shell_command_t shell_commands[] = {
+    { "state", "Prints current CongURE state object as JSON", _json_statham },
+    { "cocoa_rto", "Calls congure_cocoa_snd_rto()", _cocoa_rto },
+    { "cocoa_backoff", "Calls congure_cocoa_snd_backoff()", _cocoa_backoff },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
+
+congure_test_snd_t *congure_test_get_state(void)
+{
+    return &_congure_state;
+}
+
+static void _print_field(const char *name, uint32_t value)
+{
+    print_str("\"");
+    print_str(name);
+    print_str("\":");
+    print_u32_dec(value);
+    print_str(",");
+}
+
+static void _print_reno_state(const congure_reno_snd_t *c)
+{
+    _print_field("ssthresh", c->ssthresh);
+    _print_field("in_flight", c->in_flight);
+    _print_field("ca_acked", c->ca_acked);
+}
+
+static void _print_vegas_state(const congure_vegas_snd_t *c)
+{
+    _print_field("ssthresh", c->ssthresh);
+    _print_field("in_flight", c->in_flight);
+    _print_field("base_rtt", c->base_rtt);
+    _print_field("round_rtt", c->round_rtt);
+    _print_field("round_acked", c->round_acked);
+    _print_field("round_wnd", c->round_wnd);
+}
+
+static void _print_cubic_state(const congure_cubic_snd_t *c)
+{
+    _print_field("ssthresh", c->ssthresh);
+    _print_field("in_flight", c->in_flight);
+    _print_field("w_max", c->w_max);
+    _print_field("w_est", c->w_est);
+    _print_field("epoch_start", c->epoch_start);
+    _print_field("k", c->k);
+    _print_field("rtt", c->rtt);
+    _print_field("ca_acked", c->ca_acked);
+    print_str("\"epoch_started\":");
+    print_str(c->epoch_started ? "true" : "false");
+    print_str(",");
+}
+
+static void _print_cocoa_estimator(const char *name,
+                                   const congure_cocoa_estimator_t *e)
+{
+    print_str("\"");
+    print_str(name);
+    print_str("\":{");
+    _print_field("srtt", e->srtt);
+    _print_field("rttvar", e->rttvar);
+    _print_field("rto", e->rto);
+    print_str("},");
+}
+
+static void _print_cocoa_state(const congure_cocoa_snd_t *c)
+{
+    _print_field("in_flight", c->in_flight);
+    _print_field("rto", c->rto);
+    _print_field("rto_time", c->rto_time);
+    _print_cocoa_estimator("strong", &c->strong);
+    _print_cocoa_estimator("weak", &c->weak);
+}
+
+static int _json_statham(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    if (_congure_state.super.driver == NULL) {
+        print_str("{\"error\":\"State object not set up\"}\n");
+        return 1;
+    }
+    print_str("{");
+    _print_field("cwnd", _congure_state.super.cwnd);
+    switch (_congure_state.impl) {
+        case CONGURE_IMPL_RENO:
+            _print_reno_state(&_congure_state.reno);
+            break;
+        case CONGURE_IMPL_VEGAS:
+            _print_vegas_state(&_congure_state.vegas);
+            break;
+        case CONGURE_IMPL_CUBIC:
+            _print_cubic_state(&_congure_state.cubic);
+            break;
+        case CONGURE_IMPL_COCOA:
+            _print_cocoa_state(&_congure_state.cocoa);
+            break;
+    }
+    print_str("}\n");
+    return 0;
+}
+
+static int _scn_u32_arg(const char *arg, const char *name, uint32_t *value)
+{
+    if (!fmt_is_number(arg)) {
+        print_str("{\"error\":\"`");
+        print_str(name);
+        print_str("` expected to be integer\"}\n");
+        return -1;
+    }
+    *value = scn_u32_dec(arg, strlen(arg));
+    return 0;
+}
+
+static int _cocoa_rto(int argc, char **argv)
+{
+    uint32_t now;
+
+    if (_congure_state.impl != CONGURE_IMPL_COCOA) {
+        print_str("{\"error\":\"CoCoA not set up\"}\n");
+        return 1;
+    }
+    if (argc < 2) {
+        print_str("{\"error\":\"`now` argument expected\"}\n");
+        return 1;
+    }
+    if (_scn_u32_arg(argv[1], "now", &now) < 0) {
+        return 1;
+    }
+    print_str("{\"success\":");
+    print_u32_dec(congure_cocoa_snd_rto(&_congure_state.cocoa, now));
+    print_str("}\n");
+    return 0;
+}
+
+static int _cocoa_backoff(int argc, char **argv)
+{
+    uint32_t rto, timeout;
+
+    if (argc < 3) {
+        print_str("{\"error\":\"`rto` and `timeout` arguments expected\"}\n");
+        return 1;
+    }
+    if ((_scn_u32_arg(argv[1], "rto", &rto) < 0) ||
+        (_scn_u32_arg(argv[2], "timeout", &timeout) < 0)) {
+        return 1;
+    }
+    print_str("{\"success\":");
+    print_u32_dec(congure_cocoa_snd_backoff(rto, timeout));
+    print_str("}\n");
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,512 @@
+#! /usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import logging
+import sys
+import unittest
+
+from riotctrl.ctrl import RIOTCtrl
+from riotctrl.shell.json import RapidJSONShellInteractionParser, rapidjson
+
+from riotctrl_shell.congure_test import CongureTest
+
+# constants as set in congure_impl.c
+MSS = 100
+
+
+class TestCongUREBase(unittest.TestCase):
+    DEBUG = False
+    IMPL = None
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctrl = RIOTCtrl()
+        cls.ctrl.reset()
+        cls.ctrl.start_term()
+        if cls.DEBUG:
+            cls.ctrl.term.logfile = sys.stdout
+        cls.shell = CongureTest(cls.ctrl)
+        cls.json_parser = RapidJSONShellInteractionParser()
+        cls.json_parser.set_parser_args(
+            parse_mode=rapidjson.PM_TRAILING_COMMAS
+        )
+        cls.logger = logging.getLogger(cls.__name__)
+        if cls.DEBUG:
+            cls.logger.setLevel(logging.DEBUG)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.ctrl.stop_term()
+
+    def setUp(self):
+        self.shell.clear()
+        res = self._parse(self.shell.setup(self.IMPL))
+        self.assertIn('success', res)
+        res = self._parse(self.shell.init(0))
+        self.assertIn('success', res)
+
+    def tearDown(self):
+        self._parse(self.shell.msgs_reset())
+
+    def _parse(self, res):
+        self.logger.debug(repr(res))
+        return self.json_parser.parse(res)
+
+    def state(self):
+        return self._parse(self.shell.cmd('state'))
+
+    def sent(self, size):
+        res = self._parse(self.shell.report_msg_sent(size))
+        self.assertIn('success', res)
+
+    def acked(self, size, send_time=0, recv_time=100, resends=0):
+        res = self._parse(self.shell.report_msg_acked(
+            msg={'send_time': send_time, 'size': size, 'resends': resends},
+            ack={'recv_time': recv_time, 'id': 0, 'size': size, 'clean': True,
+                 'wnd': 0, 'delay': 0},
+        ))
+        self.assertIn('success', res)
+        self._parse(self.shell.msgs_reset())
+
+    def lost(self, size):
+        res = self._parse(self.shell.report_msgs_lost(
+            [{'send_time': 0, 'size': size, 'resends': 0}]
+        ))
+        self.assertIn('success', res)
+        self._parse(self.shell.msgs_reset())
+
+    def timed_out(self, size):
+        res = self._parse(self.shell.report_msgs_timeout(
+            [{'send_time': 0, 'size': size, 'resends': 0}]
+        ))
+        self.assertIn('success', res)
+        self._parse(self.shell.msgs_reset())
+
+
+class TestReno(TestCongUREBase):
+    IMPL = 0
+    INIT_CWND = 200
+    INIT_SSTHRESH = 600
+
+    def test_init(self):
+        state = self.state()
+        self.assertEqual(state['cwnd'], self.INIT_CWND)
+        self.assertEqual(state['ssthresh'], self.INIT_SSTHRESH)
+        self.assertEqual(state['in_flight'], 0)
+
+    def test_slow_start(self):
+        # grows by one segment per acknowledged segment ...
+        for i in range(4):
+            self.sent(MSS)
+            self.acked(MSS)
+            state = self.state()
+            self.assertEqual(state['cwnd'], self.INIT_CWND + (i + 1) * MSS)
+            self.assertEqual(state['in_flight'], 0)
+        # ... until the slow start threshold is reached
+        self.assertEqual(state['cwnd'], self.INIT_SSTHRESH)
+
+    def test_slow_start_small_msgs(self):
+        # grows by the acknowledged data only
+        self.acked(MSS // 2)
+        self.assertEqual(self.state()['cwnd'], self.INIT_CWND + MSS // 2)
+
+    def test_congestion_avoidance(self):
+        self.test_slow_start()
+        cwnd = self.INIT_SSTHRESH
+        # grows by one segment only after a whole window was acknowledged
+        for i in range(cwnd // MSS - 1):
+            self.acked(MSS)
+            state = self.state()
+            self.assertEqual(state['cwnd'], cwnd)
+            self.assertEqual(state['ca_acked'], (i + 1) * MSS)
+        self.acked(MSS)
+        state = self.state()
+        self.assertEqual(state['cwnd'], cwnd + MSS)
+        self.assertEqual(state['ca_acked'], 0)
+
+    def test_loss(self):
+        self.sent(10 * MSS)
+        self.lost(MSS)
+        state = self.state()
+        # RFC 5681, equation (4): half of the data in flight ...
+        self.assertEqual(state['ssthresh'], 5 * MSS)
+        # ... and the window continues from there
+        self.assertEqual(state['cwnd'], 5 * MSS)
+
+    def test_loss_lower_bound(self):
+        self.sent(MSS)
+        self.lost(MSS)
+        state = self.state()
+        self.assertEqual(state['ssthresh'], 2 * MSS)
+        self.assertEqual(state['cwnd'], 2 * MSS)
+
+    def test_timeout(self):
+        self.sent(10 * MSS)
+        self.timed_out(MSS)
+        state = self.state()
+        self.assertEqual(state['ssthresh'], 5 * MSS)
+        # loss window of one segment
+        self.assertEqual(state['cwnd'], MSS)
+
+
+class TestVegas(TestCongUREBase):
+    IMPL = 1
+    INIT_CWND = 200
+    ALPHA = 2
+    BETA = 4
+    GAMMA = 1
+
+    def one_round(self, rtt, cwnd=None):
+        """Acknowledges one window of segments with the given RTT"""
+        if cwnd is None:
+            cwnd = self.state()['round_wnd']
+        for _ in range(cwnd // MSS):
+            self.acked(MSS, send_time=1000, recv_time=1000 + rtt)
+        return self.state()
+
+    @staticmethod
+    def diff(cwnd, base_rtt, rtt):
+        # data queued in the network
+        return (cwnd * (rtt - base_rtt)) // rtt
+
+    def test_init(self):
+        state = self.state()
+        self.assertEqual(state['cwnd'], self.INIT_CWND)
+        self.assertEqual(state['base_rtt'], 0)
+        self.assertEqual(state['round_wnd'], self.INIT_CWND)
+
+    def _slow_start_gamma(self):
+        # no queuing: slow start doubles the window per round
+        state = self.one_round(100)
+        self.assertEqual(state['base_rtt'], 100)
+        self.assertEqual(state['cwnd'], 2 * self.INIT_CWND)
+        self.assertEqual(state['round_wnd'], 2 * self.INIT_CWND)
+        # queuing above gamma segments: leave slow start and take back half
+        # of what was queued
+        state = self.one_round(200)
+        cwnd = 4 * self.INIT_CWND
+        diff = self.diff(cwnd, 100, 200)
+        self.assertGreater(diff, self.GAMMA * MSS)
+        self.assertEqual(state['cwnd'], cwnd - diff // 2)
+        self.assertEqual(state['ssthresh'], state['cwnd'])
+        return state
+
+    def _congestion_avoidance_alpha(self):
+        cwnd = self._slow_start_gamma()['cwnd']
+        # less than alpha segments queued: grow by a segment per round
+        self.assertLess(self.diff(cwnd, 100, 100), self.ALPHA * MSS)
+        state = self.one_round(100)
+        self.assertEqual(state['cwnd'], cwnd + MSS)
+        self.assertEqual(state['round_wnd'], cwnd + MSS)
+        return state
+
+    def _congestion_avoidance_between_alpha_and_beta(self):
+        cwnd = self._congestion_avoidance_alpha()['cwnd']
+        diff = self.diff(cwnd, 100, 200)
+        self.assertGreaterEqual(diff, self.ALPHA * MSS)
+        self.assertLessEqual(diff, self.BETA * MSS)
+        state = self.one_round(200)
+        self.assertEqual(state['cwnd'], cwnd)
+        return state
+
+    def test_slow_start_gamma(self):
+        self._slow_start_gamma()
+
+    def test_congestion_avoidance_alpha(self):
+        self._congestion_avoidance_alpha()
+
+    def test_congestion_avoidance_between_alpha_and_beta(self):
+        self._congestion_avoidance_between_alpha_and_beta()
+
+    def test_congestion_avoidance_beta(self):
+        cwnd = self._congestion_avoidance_between_alpha_and_beta()['cwnd']
+        # more than beta segments queued: shrink by a segment per round
+        self.assertGreater(self.diff(cwnd, 100, 300), self.BETA * MSS)
+        state = self.one_round(300)
+        self.assertEqual(state['cwnd'], cwnd - MSS)
+        self.assertEqual(state['ssthresh'], cwnd - MSS)
+        # the base RTT is kept
+        self.assertEqual(state['base_rtt'], 100)
+
+    def test_resent_no_rtt_sample(self):
+        self.acked(MSS, send_time=0, recv_time=10, resends=1)
+        self.assertEqual(self.state()['base_rtt'], 0)
+
+    def test_loss(self):
+        cwnd = self._slow_start_gamma()['cwnd']
+        self.lost(MSS)
+        state = self.state()
+        self.assertEqual(state['cwnd'], (cwnd * 3) // 4)
+        self.assertEqual(state['ssthresh'], (cwnd * 3) // 4)
+        self.assertEqual(state['round_acked'], 0)
+
+    def test_timeout(self):
+        self._slow_start_gamma()
+        self.sent(10 * MSS)
+        self.timed_out(MSS)
+        state = self.state()
+        self.assertEqual(state['cwnd'], MSS)
+        self.assertEqual(state['ssthresh'], 5 * MSS)
+        # the base RTT is measured anew
+        self.assertEqual(state['base_rtt'], 0)
+
+
+class TestCubic(TestCongUREBase):
+    IMPL = 2
+    INIT_CWND = 10000
+    C = 0.4
+    BETA = 717 / 1024
+
+    def w_cubic(self, t, k, w_max):
+        """RFC 8312, equation (1), t and k in ms, w_max in bytes"""
+        return w_max + self.C * ((t - k) / 1000) ** 3 * MSS
+
+    def test_slow_start(self):
+        self.acked(MSS)
+        self.assertEqual(self.state()['cwnd'], self.INIT_CWND + MSS)
+        self.acked(MSS // 2)
+        self.assertEqual(self.state()['cwnd'], self.INIT_CWND + MSS + MSS // 2)
+
+    def _loss(self):
+        self.lost(MSS)
+        state = self.state()
+        self.assertEqual(state['w_max'], self.INIT_CWND)
+        self.assertEqual(state['ssthresh'], int(self.INIT_CWND * self.BETA))
+        self.assertEqual(state['cwnd'], state['ssthresh'])
+        self.assertFalse(state['epoch_started'])
+        return state
+
+    def _k(self):
+        state = self._loss()
+        w_max = state['w_max']
+        # the first ACK in congestion avoidance starts the epoch
+        self.acked(MSS, send_time=900, recv_time=1000)
+        state = self.state()
+        self.assertTrue(state['epoch_started'])
+        self.assertEqual(state['epoch_start'], 1000)
+        self.assertEqual(state['rtt'], 100)
+        # RFC 8312, equation (2): K = cubic_root(W_max * (1 - beta) / C)
+        # with W_max = 100 segments, beta = 0.7 and C = 0.4, K is 4.2172 s
+        self.assertAlmostEqual(state['k'], 4217, delta=1)
+        k = ((w_max - int(w_max * self.BETA)) / MSS / self.C) ** (1 / 3)
+        self.assertEqual(state['k'], int(k * 1000))
+        return state
+
+    def _acked_at(self, state, t):
+        """Acknowledges a segment so that W_cubic is evaluated at t and
+        checks the growth of the window towards it"""
+        cwnd = state['cwnd']
+        rtt = state['rtt']
+        recv_time = state['epoch_start'] + t - rtt
+        self.acked(MSS, send_time=recv_time - rtt, recv_time=recv_time)
+        # the window grows at most by half of it per RTT
+        target = min(self.w_cubic(t, state['k'], state['w_max']),
+                     cwnd + cwnd // 2)
+        expected = cwnd + int(((target - cwnd) * MSS) // cwnd)
+        state = self.state()
+        self.assertAlmostEqual(state['cwnd'], expected, delta=1)
+        return state
+
+    def test_loss(self):
+        self._loss()
+
+    def test_k(self):
+        self._k()
+
+    def test_concave(self):
+        state = self._k()
+        # W_cubic(0) = beta * W_max, so the epoch starts close to the reduced
+        # window (K is rounded down to full milliseconds)
+        self.assertAlmostEqual(self.w_cubic(0, state['k'], state['w_max']),
+                               state['ssthresh'], delta=5)
+        # W_cubic(K) = W_max
+        state = self._acked_at(state, state['k'])
+        self.assertLess(state['cwnd'], state['w_max'])
+
+    def test_convex(self):
+        state = self._k()
+        # beyond K the window grows above W_max again
+        t = state['k'] + 3000
+        self.assertGreater(self.w_cubic(t, state['k'], state['w_max']),
+                           state['w_max'])
+        self._acked_at(state, t)
+
+    def test_fast_convergence(self):
+        cwnd = self._loss()['cwnd']
+        # a loss below the last W_max releases bandwidth faster
+        self.lost(MSS)
+        state = self.state()
+        self.assertEqual(state['w_max'], int(cwnd * (1 + self.BETA) / 2))
+        self.assertEqual(state['ssthresh'], int(cwnd * self.BETA))
+        self.assertEqual(state['cwnd'], state['ssthresh'])
+
+    def test_timeout(self):
+        self.timed_out(MSS)
+        state = self.state()
+        self.assertEqual(state['w_max'], self.INIT_CWND)
+        self.assertEqual(state['ssthresh'], int(self.INIT_CWND * self.BETA))
+        self.assertEqual(state['cwnd'], MSS)
+        self.assertFalse(state['epoch_started'])
+
+
+class TestCocoa(TestCongUREBase):
+    IMPL = 3
+    NSTART = 1
+    INIT_RTO = 2000
+    RTO_MAX = 60000
+
+    def rto(self, now):
+        res = self._parse(self.shell.cmd('cocoa_rto {}'.format(now)))
+        self.assertIn('success', res)
+        return res['success']
+
+    def backoff(self, rto, timeout):
+        res = self._parse(self.shell.cmd(
+            'cocoa_backoff {} {}'.format(rto, timeout)
+        ))
+        self.assertIn('success', res)
+        return res['success']
+
+    def test_init(self):
+        state = self.state()
+        self.assertEqual(state['cwnd'], self.NSTART)
+        self.assertEqual(state['in_flight'], 0)
+        self.assertEqual(state['rto'], self.INIT_RTO)
+        self.assertEqual(state['rto_time'], 0)
+        self.assertEqual(state['strong']['rto'], 0)
+        self.assertEqual(state['weak']['rto'], 0)
+
+    def test_in_flight(self):
+        self.sent(1)
+        self.assertEqual(self.state()['in_flight'], 1)
+        self.acked(1, send_time=1000, recv_time=1100)
+        self.assertEqual(self.state()['in_flight'], 0)
+
+    def _strong_estimator(self):
+        # RFC 6298 with K = 4: the first sample sets SRTT = RTT and
+        # RTTVAR = RTT / 2, the strong RTO is 100 + 4 * 50 = 300
+        self.acked(1, send_time=1000, recv_time=1100)
+        state = self.state()
+        self.assertEqual(state['strong'], {'srtt': 100, 'rttvar': 50,
+                                           'rto': 300})
+        # the overall RTO moves halfway to the strong RTO
+        self.assertEqual(state['rto'], (300 + self.INIT_RTO) // 2)
+        self.assertEqual(state['rto_time'], 1100)
+        self.assertEqual(state['weak']['rto'], 0)
+        # RTTVAR = 3/4 * 50 + 1/4 * |100 - 100| and SRTT stays 100
+        self.acked(1, send_time=1100, recv_time=1200)
+        state = self.state()
+        self.assertEqual(state['strong'], {'srtt': 100, 'rttvar': 37,
+                                           'rto': 248})
+        self.assertEqual(state['rto'], (248 + 1150) // 2)
+        self.assertEqual(state['rto_time'], 1200)
+        return state
+
+    def test_strong_estimator(self):
+        self._strong_estimator()
+
+    def test_weak_estimator(self):
+        # RFC 6298 with K = 1, measured from the first transmission: the weak
+        # RTO is 1000 + 500 = 1500
+        self.acked(1, send_time=1000, recv_time=2000, resends=1)
+        state = self.state()
+        self.assertEqual(state['weak'], {'srtt': 1000, 'rttvar': 500,
+                                         'rto': 1500})
+        # the overall RTO moves a quarter of the way to the weak RTO
+        self.assertEqual(state['rto'], (1500 + 3 * self.INIT_RTO) // 4)
+        self.assertEqual(state['rto_time'], 2000)
+        self.assertEqual(state['strong']['rto'], 0)
+
+    def test_weak_estimator_two_resends(self):
+        self.acked(1, send_time=1000, recv_time=2000, resends=2)
+        state = self.state()
+        self.assertEqual(state['weak']['rto'], 1500)
+        self.assertEqual(state['rto'], (1500 + 3 * self.INIT_RTO) // 4)
+
+    def test_weak_estimator_ambiguous(self):
+        self.sent(1)
+        # samples with more than 2 resends are ignored ...
+        self.acked(1, send_time=1000, recv_time=2000, resends=3)
+        state = self.state()
+        self.assertEqual(state['weak']['rto'], 0)
+        self.assertEqual(state['strong']['rto'], 0)
+        self.assertEqual(state['rto'], self.INIT_RTO)
+        self.assertEqual(state['rto_time'], 0)
+        # ... but the message is no longer in flight
+        self.assertEqual(state['in_flight'], 0)
+
+    def test_backoff_small_rto(self):
+        # the variable backoff factor is 3 below 1 s ...
+        rto = self._strong_estimator()['rto']
+        self.assertLess(rto, 1000)
+        self.assertEqual(self.backoff(rto, rto), 3 * rto)
+        self.assertEqual(self.backoff(999, 3 * 999), 9 * 999)
+        # ... and 2 at 1 s
+        self.assertEqual(self.backoff(1000, 1000), 2000)
+
+    def test_backoff_large_rto(self):
+        # the variable backoff factor is 1.5 above 3 s ...
+        self.assertEqual(self.backoff(3001, 4000), 6000)
+        self.assertEqual(self.backoff(3001, 6000), 9000)
+        # ... and 2 at 3 s
+        self.assertEqual(self.backoff(3000, 4000), 8000)
+
+    def test_backoff_default(self):
+        self.assertEqual(self.backoff(self.INIT_RTO, self.INIT_RTO),
+                         2 * self.INIT_RTO)
+
+    def test_backoff_upper_bound(self):
+        self.assertEqual(self.backoff(self.INIT_RTO, 40000), self.RTO_MAX)
+        self.assertEqual(self.backoff(500, 30000), self.RTO_MAX)
+
+    def test_aging_small_rto(self):
+        state = self._strong_estimator()
+        rto = state['rto']
+        rto_time = state['rto_time']
+        # an RTO below 1 s is doubled after 16 RTOs without update
+        self.assertEqual(self.rto(rto_time + 16 * rto - 1), rto)
+        self.assertEqual(self.rto(rto_time + 16 * rto), 2 * rto)
+        state = self.state()
+        self.assertEqual(state['rto'], 2 * rto)
+        self.assertEqual(state['rto_time'], rto_time + 16 * rto)
+        # an RTO between 1 s and 3 s does not age
+        self.assertEqual(self.rto(rto_time + 1000 * rto), 2 * rto)
+
+    def test_aging_large_rto(self):
+        # RTO = 3000 + 4 * 1500 for the strong estimator
+        self.acked(1, send_time=1000, recv_time=4000)
+        state = self.state()
+        self.assertEqual(state['strong']['rto'], 9000)
+        rto = state['rto']
+        self.assertEqual(rto, (9000 + self.INIT_RTO) // 2)
+        rto_time = state['rto_time']
+        # an RTO above 3 s moves halfway towards the initial RTO after 4 RTOs
+        # without update
+        self.assertEqual(self.rto(rto_time + 4 * rto - 1), rto)
+        rto_time += 4 * rto
+        rto = (self.INIT_RTO + rto) // 2
+        self.assertEqual(self.rto(rto_time), rto)
+        self.assertEqual(self.state()['rto_time'], rto_time)
+        self.assertGreater(rto, 3000)
+        rto_time += 4 * rto
+        rto = (self.INIT_RTO + rto) // 2
+        self.assertEqual(self.rto(rto_time), rto)
+        # an RTO between 1 s and 3 s does not age
+        self.assertLessEqual(rto, 3000)
+        self.assertEqual(self.rto(rto_time + 1000 * rto), rto)
+
+    def test_rto_wrong_impl(self):
+        self.shell.clear()
+        res = self._parse(self.shell.setup(0))
+        self.assertIn('success', res)
+        res = self._parse(self.shell.cmd('cocoa_rto 0'))
+        self.assertIn('error', res)
+
+
+if __name__ == '__main__':
+    unittest.main()
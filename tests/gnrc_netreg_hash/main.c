@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the gnrc_netreg unittests against the hashed registry
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/nettype.h"
+
+#include "unittests-constants.h"
+#include "tests-netreg.h"
+
+/* more entries than buckets, so some of them collide */
+#define ENTRIES_NUMOF   (4U << CONFIG_GNRC_NETREG_HASH_SIZE_EXP)
+
+static gnrc_netreg_entry_t entries[ENTRIES_NUMOF];
+
+static gnrc_nettype_t _type(unsigned i)
+{
+    return (i & 1) ? GNRC_NETTYPE_UNDEF : GNRC_NETTYPE_TEST;
+}
+
+static void set_up(void)
+{
+    gnrc_netreg_init();
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+        gnrc_netreg_entry_init_pid(&entries[i], TEST_UINT16 + (i / 2), TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(_type(i), &entries[i]));
+    }
+}
+
+static void test_netreg_hash__lookup(void)
+{
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(_type(i), TEST_UINT16 + (i / 2));
+
+        TEST_ASSERT(res == &entries[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(_type(i), TEST_UINT16 + (i / 2)));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + ENTRIES_NUMOF));
+}
+
+static void test_netreg_hash__unregister(void)
+{
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i += 3) {
+        gnrc_netreg_unregister(_type(i), &entries[i]);
+    }
+    for (unsigned i = 0; i < ENTRIES_NUMOF; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(_type(i), TEST_UINT16 + (i / 2));
+
+        if ((i % 3) == 0) {
+            TEST_ASSERT_NULL(res);
+        }
+        else {
+            TEST_ASSERT(res == &entries[i]);
+        }
+    }
+}
+
+static Test *tests_netreg_hash_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netreg_hash__lookup),
+        new_TestFixture(test_netreg_hash__unregister),
+    };
+
+    EMB_UNIT_TESTCALLER(netreg_hash_tests, set_up, NULL, fixtures);
+
+    return (Test *)&netreg_hash_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    tests_netreg();
+    TESTS_RUN(tests_netreg_hash_tests());
+    TESTS_END();
+
+    return 0;
+}
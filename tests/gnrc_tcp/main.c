@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -13,6 +14,14 @@
 #include "msg.h"
 #include "net/af.h"
 #include "net/gnrc/tcp.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include "congure/cubic.h"
+#include "congure/reno.h"
+#include "congure/vegas.h"
+#endif
 
 #define MAIN_QUEUE_SIZE (8)
 #define TCB_QUEUE_SIZE (1)
@@ -24,6 +33,71 @@ static gnrc_tcp_tcb_t *tcb = tcbs;
 static gnrc_tcp_tcb_queue_t queue = GNRC_TCP_TCB_QUEUE_INIT;
 static char buffer[BUFFER_SIZE];
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+static const congure_reno_snd_consts_t reno_consts = {
+    .mss = CONFIG_GNRC_TCP_MSS,
+    .init_cwnd = 2 * CONFIG_GNRC_TCP_MSS,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .cwnd_lower = CONFIG_GNRC_TCP_MSS,
+    .cwnd_upper = CONGURE_WND_SIZE_MAX,
+};
+
+static const congure_vegas_snd_consts_t vegas_consts = {
+    .mss = CONFIG_GNRC_TCP_MSS,
+    .init_cwnd = 2 * CONFIG_GNRC_TCP_MSS,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .cwnd_lower = CONFIG_GNRC_TCP_MSS,
+    .cwnd_upper = CONGURE_WND_SIZE_MAX,
+    .alpha = 1,
+    .beta = 3,
+    .gamma = 1,
+};
+
+static const congure_cubic_snd_consts_t cubic_consts = {
+    .mss = CONFIG_GNRC_TCP_MSS,
+    .init_cwnd = 2 * CONFIG_GNRC_TCP_MSS,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .cwnd_lower = CONFIG_GNRC_TCP_MSS,
+    .cwnd_upper = CONGURE_WND_SIZE_MAX,
+    .c = 400,
+    .beta = 717,
+    .fast_convergence = true,
+};
+
+static union {
+    congure_reno_snd_t reno;
+    congure_vegas_snd_t vegas;
+    congure_cubic_snd_t cubic;
+} congures[TCB_QUEUE_SIZE];
+
+/* congestion control applied on gnrc_tcp_tcb_init */
+static char congure_name[8] = "none";
+#endif
+
+static void congure_setup(gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+#ifdef MODULE_GNRC_TCP_CONGURE
+    congure_snd_t *c = NULL;
+
+    if (strcmp(congure_name, "reno") == 0) {
+        congure_reno_snd_setup(&congures[idx].reno, &reno_consts);
+        c = &congures[idx].reno.super;
+    }
+    else if (strcmp(congure_name, "vegas") == 0) {
+        congure_vegas_snd_setup(&congures[idx].vegas, &vegas_consts);
+        c = &congures[idx].vegas.super;
+    }
+    else if (strcmp(congure_name, "cubic") == 0) {
+        congure_cubic_snd_setup(&congures[idx].cubic, &cubic_consts);
+        c = &congures[idx].cubic.super;
+    }
+    gnrc_tcp_tcb_set_congure(tcb, c);
+#else
+    (void)tcb;
+    (void)idx;
+#endif
+}
+
 void dump_args(int argc, char **argv)
 {
     printf("%s: ", argv[0]);
@@ -129,6 +203,7 @@ int gnrc_tcp_tcb_init_cmd(int argc, char **argv)
     for (int i = 0; i < TCB_QUEUE_SIZE; ++i)
     {
         gnrc_tcp_tcb_init(&(tcbs[i]));
+        congure_setup(&(tcbs[i]), i);
     }
     printf("%s: returns 0\n", argv[0]);
     return 0;
@@ -251,6 +326,7 @@ int gnrc_tcp_send_cmd(int argc, char **argv)
     size_t timeout = atol(argv[1]);
     size_t to_send = atol(argv[2]);
     size_t sent = 0;
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
 
     do {
         int ret = gnrc_tcp_send(tcb, buffer + sent, to_send - sent, timeout);
@@ -278,10 +354,49 @@ int gnrc_tcp_send_cmd(int argc, char **argv)
         sent += ret;
     } while (sent < to_send);
 
+    uint32_t time = ztimer_now(ZTIMER_MSEC) - start;
     printf("%s: sent %u\n", argv[0], (unsigned)sent);
+    printf("%s: time %" PRIu32 " ms, throughput %" PRIu32 " B/s\n", argv[0],
+           time, (uint32_t)((uint64_t)sent * MS_PER_SEC / (time ? time : 1)));
     return sent;
 }
 
+int gnrc_tcp_send_resume_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    size_t timeout = atol(argv[1]);
+    size_t to_send = atol(argv[2]);
+    unsigned rounds = atoi(argv[3]);
+    unsigned timeouts = 0;
+
+    /* Send the buffer contents repeatedly, continuing after each timeout
+     * right after the acknowledged data */
+    for (unsigned i = 0; i < rounds; i++) {
+        size_t sent = 0;
+
+        while (sent < to_send) {
+            int ret = gnrc_tcp_send(tcb, buffer + sent, to_send - sent, timeout);
+            if (ret == -ETIMEDOUT) {
+                timeouts++;
+                continue;
+            }
+            if (ret < 0) {
+                printf("%s: returns %d\n", argv[0], ret);
+                return ret;
+            }
+            if ((size_t)ret < to_send - sent) {
+                timeouts++;
+            }
+            sent += ret;
+        }
+    }
+
+    printf("%s: sent %u, timeouts %u\n", argv[0], (unsigned)(to_send * rounds),
+           timeouts);
+    return 0;
+}
+
 int gnrc_tcp_recv_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -421,6 +536,39 @@ int gnrc_tcp_queue_get_local_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_congure_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+#ifdef MODULE_GNRC_TCP_CONGURE
+    if ((argc < 2) || (strlen(argv[1]) >= sizeof(congure_name))) {
+        printf("%s: returns -EINVAL\n", argv[0]);
+        return -EINVAL;
+    }
+    strcpy(congure_name, argv[1]);
+    printf("%s: returns 0\n", argv[0]);
+    return 0;
+#else
+    printf("%s: returns -ENOTSUP\n", argv[0]);
+    return -ENOTSUP;
+#endif
+}
+
+int gnrc_tcp_stats_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+    unsigned cwnd = 0;
+
+#ifdef MODULE_GNRC_TCP_CONGURE
+    if (tcb->congure) {
+        cwnd = tcb->congure->cwnd;
+    }
+#endif
+    printf("%s: srtt=%" PRIi32 " rtt_var=%" PRIi32 " rto=%" PRIi32
+           " snd_wnd=%u cwnd=%u\n", argv[0], tcb->srtt, tcb->rtt_var, tcb->rto,
+           tcb->snd_wnd, cwnd);
+    return 0;
+}
+
 /* Exporting GNRC TCP Api to for shell usage */
 static const shell_command_t shell_commands[] = {
     { "gnrc_tcp_ep_from_str", "Build endpoint from string",
@@ -435,6 +583,8 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_accept_cmd },
     { "gnrc_tcp_send", "gnrc_tcp: send data to connected peer",
       gnrc_tcp_send_cmd },
+    { "gnrc_tcp_send_resume", "gnrc_tcp: send data repeatedly, resuming after timeouts",
+      gnrc_tcp_send_resume_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
       gnrc_tcp_recv_cmd },
     { "gnrc_tcp_close", "gnrc_tcp: close connection gracefully",
@@ -449,6 +599,10 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_get_remote_cmd },
     { "gnrc_tcp_queue_get_local", "gnrc_tcp: get queue local",
       gnrc_tcp_queue_get_local_cmd },
+    { "gnrc_tcp_congure", "select congestion control (none|reno|vegas|cubic)",
+      gnrc_tcp_congure_cmd },
+    { "gnrc_tcp_stats", "print RTT estimation and windows",
+      gnrc_tcp_stats_cmd },
     { "buffer_init", "init internal buffer",
       buffer_init_cmd },
     { "buffer_get_max_size", "get max size of internal buffer",
@@ -15,7 +15,7 @@ import base64
 from scapy.all import Ether, IPv6, TCP, raw, sendp
 
 from helpers import Runner, RiotTcpServer, RiotTcpClient, HostTcpServer, HostTcpClient, \
-                    generate_port_number, sudo_guard
+                    generate_port_number, riot_select_congure, sudo_guard
 
 # Custom NO_TIMEOUT constant. Note: the value must match
 # with CUSTOM_GNRC_TCP_NO_TIMEOUT from the makefile
@@ -65,6 +65,65 @@ def test_send_data_from_riot_to_host(child):
             host_srv.close()
 
 
+@Runner(timeout=20)
+def test_send_data_resumes_after_timeout(child):
+    """ Send Data from RIOT Node to Host system with a user timeout that
+        expires while data is in flight, continuing with the unacknowledged data
+    """
+    with HostTcpServer(generate_port_number()) as host_srv:
+        with RiotTcpClient(child, host_srv) as riot_cli:
+            host_srv.accept()
+
+            # A timeout of 2 ms expires regularly before the data was acknowledged.
+            # The data in flight is dropped and must be sent again without leaving
+            # a gap in the sequence space, otherwise the host stalls.
+            data = '0123456789' * 200
+            rounds = 10
+            riot_cli.send_resume(timeout_ms=2, payload_to_send=data, rounds=rounds)
+            host_srv.receive(data * rounds)
+            assert riot_cli.timeouts > 0
+
+            host_srv.close()
+
+
+def _send_data_with_congure(child, algorithm):
+    riot_select_congure(child, algorithm)
+    with HostTcpServer(generate_port_number()) as host_srv:
+        with RiotTcpClient(child, host_srv) as riot_cli:
+            host_srv.accept()
+
+            data = '0123456789' * 200
+            riot_cli.send(timeout_ms=0, payload_to_send=data)
+            host_srv.receive(data)
+
+            # The RTT was measured and the congestion window is in use
+            stats = riot_cli.stats()
+            print('\n{}: {} B/s, {}'.format(algorithm, riot_cli.throughput, stats))
+            assert stats['srtt'] > 0
+            assert stats['rto'] >= stats['srtt']
+            assert stats['cwnd'] > 0
+
+            host_srv.close()
+
+
+@Runner(timeout=5)
+def test_send_data_with_congure_reno(child):
+    """ Send Data from RIOT Node to Host system using Reno """
+    _send_data_with_congure(child, 'reno')
+
+
+@Runner(timeout=5)
+def test_send_data_with_congure_vegas(child):
+    """ Send Data from RIOT Node to Host system using Vegas """
+    _send_data_with_congure(child, 'vegas')
+
+
+@Runner(timeout=5)
+def test_send_data_with_congure_cubic(child):
+    """ Send Data from RIOT Node to Host system using CUBIC """
+    _send_data_with_congure(child, 'cubic')
+
+
 @Runner(timeout=5)
 def test_send_data_from_host_to_riot(child):
     """ Send Data from Host system to RIOT node """
@@ -152,6 +152,27 @@ class _RiotTcpNode:
         # Send buffer contents via tcp
         self.child.sendline('gnrc_tcp_send {} {}'.format(timeout_ms, bytes_to_send))
         self.child.expect_exact('gnrc_tcp_send: sent {}'.format(bytes_to_send))
+        self.child.expect(r'gnrc_tcp_send: time (\d+) ms, throughput (\d+) B/s')
+        self.throughput = int(self.child.match.group(2))
+
+        # Verify that packet buffer is empty
+        self._verify_pktbuf_empty()
+
+    def send_resume(self, timeout_ms, payload_to_send, rounds):
+        total_bytes = len(payload_to_send)
+
+        # Verify that internal buffer can hold the given amount of data
+        assert self._setup_internal_buffer() >= total_bytes
+
+        # Write data to RIOT nodes internal buffer
+        self._write_data_to_internal_buffer(payload_to_send)
+
+        # Send buffer contents via tcp, resuming after each timeout
+        self.child.sendline('gnrc_tcp_send_resume {} {} {}'.format(timeout_ms, total_bytes,
+                                                                   rounds))
+        self.child.expect(r'gnrc_tcp_send_resume: sent {}, timeouts (\d+)'.format(
+                          total_bytes * rounds))
+        self.timeouts = int(self.child.match.group(1))
 
         # Verify that packet buffer is empty
         self._verify_pktbuf_empty()
@@ -184,6 +205,13 @@ class _RiotTcpNode:
         self._verify_pktbuf_empty()
         self.opened = False
 
+    def stats(self):
+        self.child.sendline('gnrc_tcp_stats')
+        self.child.expect(r'gnrc_tcp_stats: srtt=(-?\d+) rtt_var=(-?\d+) rto=(-?\d+) '
+                          r'snd_wnd=(\d+) cwnd=(\d+)')
+        keys = ('srtt', 'rtt_var', 'rto', 'snd_wnd', 'cwnd')
+        return dict(zip(keys, (int(v) for v in self.child.match.groups())))
+
     def get_local(self):
         self.child.sendline('gnrc_tcp_get_local')
         self.child.expect_exact('gnrc_tcp_get_local: returns 0')
@@ -240,6 +268,11 @@ class _RiotTcpNode:
         )
 
 
+def riot_select_congure(child, algorithm):
+    child.sendline('gnrc_tcp_congure {}'.format(algorithm))
+    child.expect_exact('gnrc_tcp_congure: returns 0')
+
+
 class RiotTcpServer(_RiotTcpNode):
     def __init__(self, child, listen_port, listen_addr='::'):
         super().__init__(child)
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test msg_send_many() and msg_receive_many()
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE          (4U)
+#define SEND_NUMOF          (QUEUE_SIZE + 2)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[QUEUE_SIZE];
+static msg_t _rx[2 * QUEUE_SIZE];
+static volatile int _received;
+static unsigned _failures;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+    while (1) {
+        _received = msg_receive_many(_rx, ARRAY_SIZE(_rx));
+        thread_sleep();
+    }
+
+    return NULL;
+}
+
+static void _expect(bool cond, const char *what)
+{
+    if (!cond) {
+        printf("FAILED: %s\n", what);
+        _failures++;
+    }
+}
+
+static void _prepare(msg_t *m, unsigned numof, uint16_t first)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        m[i].type = first + i;
+        m[i].content.value = 0x100 + first + i;
+    }
+}
+
+static bool _in_order(unsigned numof, uint16_t first)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if ((_rx[i].type != first + i) ||
+            (_rx[i].content.value != 0x100U + first + i) ||
+            (_rx[i].sender_pid != thread_getpid())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    msg_t m[SEND_NUMOF];
+    int res;
+
+    puts("msg_send_many() test");
+
+    /* the receiver runs first and blocks in msg_receive_many() */
+    kernel_pid_t receiver = thread_create(_stack, sizeof(_stack),
+                                          THREAD_PRIORITY_MAIN - 1,
+                                          THREAD_CREATE_STACKTEST,
+                                          _receiver, NULL, "receiver");
+
+    /* blocked receiver: first message is copied directly, QUEUE_SIZE more
+     * are queued, the last one does not fit */
+    _prepare(m, SEND_NUMOF, 0);
+    res = msg_send_many(m, SEND_NUMOF, receiver);
+    _expect(res == QUEUE_SIZE + 1, "direct copy: messages sent");
+    _expect(_received == QUEUE_SIZE + 1, "direct copy: messages received");
+    _expect(_in_order(QUEUE_SIZE + 1, 0), "direct copy: message order");
+
+    /* sleeping receiver: the queue takes QUEUE_SIZE messages, then nothing */
+    _received = 0;
+    _prepare(m, SEND_NUMOF, 10);
+    res = msg_send_many(m, SEND_NUMOF, receiver);
+    _expect(res == QUEUE_SIZE, "full queue: messages sent");
+    res = msg_send_many(m, 2, receiver);
+    _expect(res == 0, "full queue: messages sent to full queue");
+    _expect(_received == 0, "full queue: receiver woken up");
+    thread_wakeup(receiver);
+    _expect(_received == QUEUE_SIZE, "full queue: messages received");
+    _expect(_in_order(QUEUE_SIZE, 10), "full queue: message order");
+
+    /* nothing to send */
+    res = msg_send_many(m, 0, receiver);
+    _expect(res == 0, "no messages: messages sent");
+
+    /* invalid targets */
+    res = msg_send_many(m, 1, KERNEL_PID_UNDEF);
+    _expect(res == -1, "KERNEL_PID_UNDEF: return value");
+    res = msg_send_many(m, 1, KERNEL_PID_LAST + 1);
+    _expect(res == -1, "KERNEL_PID_LAST + 1: return value");
+
+    if (_failures) {
+        puts("Test failed.");
+    }
+    else {
+        puts("Test successful.");
+    }
+
+    return 0;
+}
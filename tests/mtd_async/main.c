@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "board.h"
+#include "embUnit.h"
+#include "event.h"
+#include "mutex.h"
+
+#include "mtd.h"
+#include "mtd_async.h"
+
+/* Test mock object implementing a simple RAM-based NOR flash */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 8
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+#define LOG_NUMOF           (8)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+typedef struct {
+    char op;
+    uint32_t pos;       /* page, sector for erases */
+    uint32_t count;     /* bytes, sectors for erases */
+} log_entry_t;
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static log_entry_t _log[LOG_NUMOF];
+static unsigned _log_numof;
+/* held by the test to keep the worker busy while requests get queued */
+static mutex_t _block = MUTEX_INIT;
+
+static mtd_async_t _async;
+static mtd_async_req_t _reqs[5];
+static unsigned _completed;
+static event_queue_t _events;
+static event_t _event;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static void _log_op(char op, uint32_t pos, uint32_t count)
+{
+    mutex_lock(&_block);
+    mutex_unlock(&_block);
+    if (_log_numof < LOG_NUMOF) {
+        _log[_log_numof++] = (log_entry_t){ .op = op, .pos = pos,
+                                            .count = count };
+    }
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    _log_op('r', page, size);
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *src = buff;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    _log_op('w', page, size);
+    size = MIN(dev->page_size - offset, size);
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= src[i];
+    }
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    _log_op('e', sector, count);
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static void _done(mtd_async_req_t *req)
+{
+    TEST_ASSERT_EQUAL_INT(0, req->res);
+    _completed++;
+}
+
+static void _test_log(unsigned idx, char op, uint32_t pos, uint32_t count)
+{
+    TEST_ASSERT(idx < _log_numof);
+    TEST_ASSERT_EQUAL_INT(op, _log[idx].op);
+    TEST_ASSERT_EQUAL_INT(pos, _log[idx].pos);
+    TEST_ASSERT_EQUAL_INT(count, _log[idx].count);
+}
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+/* queues an erase of the last sector that blocks the worker */
+static void _block_worker(mtd_async_req_t *req)
+{
+    mutex_lock(&_block);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&_async, req, SECTOR_COUNT - 1,
+                                             1));
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_reqs, 0, sizeof(_reqs));
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs); i++) {
+        _reqs[i].cb = _done;
+    }
+    _log_numof = 0;
+    _completed = 0;
+}
+
+static void test_mtd_async_reorder(void)
+{
+    _block_worker(&_reqs[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_async, &_reqs[1], _buffer,
+                                             5 * PAGE_PER_SECTOR, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&_async, &_reqs[2], 3, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&_async, &_reqs[3], 2, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_async, &_reqs[4], _buffer,
+                                            PAGE_PER_SECTOR, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, _completed);
+    mutex_unlock(&_block);
+
+    /* the worker has the higher priority */
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_reqs), _completed);
+    TEST_ASSERT_EQUAL_INT(4, _log_numof);
+    _test_log(0, 'e', SECTOR_COUNT - 1, 1);
+    _test_log(1, 'r', PAGE_PER_SECTOR, 8);
+    /* erases of sectors 2 and 3 are merged */
+    _test_log(2, 'e', 2, 2);
+    _test_log(3, 'w', 5 * PAGE_PER_SECTOR, 8);
+}
+
+static void test_mtd_async_conflict(void)
+{
+    memset(_buffer, 0, sizeof(_buffer));
+
+    _block_worker(&_reqs[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_async, &_reqs[1], _buffer,
+                                             4 * PAGE_PER_SECTOR, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&_async, &_reqs[2], 4, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_async, &_reqs[3], _buffer,
+                                            4 * PAGE_PER_SECTOR, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&_async, &_reqs[4], 1, 1));
+    mutex_unlock(&_block);
+
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_reqs), _completed);
+    TEST_ASSERT_EQUAL_INT(5, _log_numof);
+    _test_log(0, 'e', SECTOR_COUNT - 1, 1);
+    _test_log(1, 'e', 1, 1);
+    _test_log(2, 'w', 4 * PAGE_PER_SECTOR, 8);
+    _test_log(3, 'e', 4, 1);
+    _test_log(4, 'r', 4 * PAGE_PER_SECTOR, 8);
+    /* read after the erase */
+    _test_mem(_buffer, 8, 0xff);
+}
+
+static void test_mtd_async_merge(void)
+{
+    memset(_buffer, 0x5a, sizeof(_buffer));
+
+    _block_worker(&_reqs[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_async, &_reqs[1], _buffer,
+                                             0, 0, 16));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_async, &_reqs[2], _buffer + 16,
+                                             0, 16, 16));
+    /* the same location but not from consecutive memory */
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_async, &_reqs[3], _buffer,
+                                             0, 32, 16));
+    mutex_unlock(&_block);
+
+    TEST_ASSERT_EQUAL_INT(4, _completed);
+    TEST_ASSERT_EQUAL_INT(3, _log_numof);
+    _test_log(1, 'w', 0, 32);
+    _test_log(2, 'w', 0, 16);
+    _test_mem(_dummy_memory, 48, 0x5a);
+    _test_mem(_dummy_memory + 48, 16, 0xff);
+}
+
+static void test_mtd_async_event(void)
+{
+    _dummy_memory[0] = 0x42;
+
+    _reqs[0].cb = NULL;
+    _reqs[0].event = &_event;
+    _reqs[0].queue = &_events;
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_async, &_reqs[0], _buffer,
+                                            0, 0, 1));
+    TEST_ASSERT(event_wait(&_events) == &_event);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[0]);
+}
+
+static void test_mtd_async_invalid(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EINVAL, mtd_async_erase(&_async, &_reqs[0], 0, 0));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_async_erase(&_async, &_reqs[0], SECTOR_COUNT,
+                                          1));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_async_read(&_async, &_reqs[0], _buffer,
+                                         SECTOR_COUNT * PAGE_PER_SECTOR - 1,
+                                         PAGE_SIZE - 1, 2));
+    TEST_ASSERT_EQUAL_INT(0, _completed);
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_reorder),
+        new_TestFixture(test_mtd_async_conflict),
+        new_TestFixture(test_mtd_async_merge),
+        new_TestFixture(test_mtd_async_event),
+        new_TestFixture(test_mtd_async_invalid),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+#if defined(MTD_0) && defined(BOARD_NATIVE)
+/* file backed flash emulation of native */
+static void test_mtd_async_native(void)
+{
+    static mtd_async_t async;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(MTD_0));
+    mtd_async_init(&async, MTD_0);
+    _reqs[0].cb = NULL;
+    _reqs[0].event = &_event;
+    _reqs[0].queue = &_events;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase(&async, &_reqs[0], 0, 1));
+    TEST_ASSERT(event_wait(&_events) == &_event);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+
+    memset(_buffer, 0x3c, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&async, &_reqs[0], _buffer,
+                                             0, 0, 32));
+    TEST_ASSERT(event_wait(&_events) == &_event);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+
+    memset(_buffer, 0, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&async, &_reqs[0], _buffer,
+                                            0, 0, 64));
+    TEST_ASSERT(event_wait(&_events) == &_event);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+    _test_mem(_buffer, 32, 0x3c);
+    _test_mem(_buffer + 32, 32, 0xff);
+}
+
+Test *tests_mtd_async_native_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_native),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_native_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_native_tests;
+}
+#endif
+
+int main(void)
+{
+    event_queue_init(&_events);
+    mtd_init(&_dev);
+    mtd_async_init(&_async, &_dev);
+
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+#if defined(MTD_0) && defined(BOARD_NATIVE)
+    TESTS_RUN(tests_mtd_async_native_tests());
+#endif
+    TESTS_END();
+    return 0;
+}
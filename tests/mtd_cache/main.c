@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "board.h"
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based NOR flash */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 8
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+#define CACHE_NUMOF         (2)
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static unsigned _reads, _writes, _erases;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *src = buff;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    /* programming can only clear bits */
+    for (uint32_t i = 0; i < size; i++) {
+        _dummy_memory[addr + i] &= src[i];
+    }
+    _writes++;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+    _erases++;
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _parent = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_entry_t _entries[CACHE_NUMOF];
+static uint8_t _pages[CACHE_NUMOF * PAGE_SIZE];
+static uint8_t _wb[SECTOR_SIZE];
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_parent, _entries, _pages, _wb);
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void set_up(void)
+{
+    /* also drops pending writes and cached pages, fails before init */
+    mtd_erase_sector(_dev, 0, SECTOR_COUNT);
+    memset(&_cache.stats, 0, sizeof(_cache.stats));
+    _reads = 0;
+    _writes = 0;
+    _erases = 0;
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_cache_read_hit(void)
+{
+    _dummy_memory[PAGE_SIZE + 1] = 0x42;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 0, 16));
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[1]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE + 1, 1));
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[0]);
+
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(2, _cache.stats.hits);
+}
+
+static void test_mtd_cache_lru(void)
+{
+    /* fill the cache with pages 0 and 1, page 0 is used more recently */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    /* evicts page 1 */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 2, 0, 1));
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 0, 1));
+    TEST_ASSERT_EQUAL_INT(4, _reads);
+    TEST_ASSERT_EQUAL_INT(4, _cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.hits);
+}
+
+static void test_mtd_cache_read_large(void)
+{
+    /* reads spanning multiple pages do not thrash the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 4, 0, SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xff);
+    TEST_ASSERT_EQUAL_INT(1 + PAGE_PER_SECTOR, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(1 + PAGE_PER_SECTOR, _reads);
+}
+
+static void test_mtd_cache_write_combine(void)
+{
+    /* program a sector in small chunks */
+    memset(_buffer, 0xaa, sizeof(_buffer));
+    for (uint32_t addr = 0; addr < SECTOR_SIZE; addr += 16) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE + addr,
+                                           16));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT((SECTOR_SIZE / 16) - 1, _cache.stats.merged);
+
+    /* pending writes are visible */
+    memset(_buffer, 0, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE,
+                                      SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xaa);
+    _test_mem(_dummy_memory + SECTOR_SIZE, SECTOR_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.flushes);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _writes);
+    _test_mem(_dummy_memory + SECTOR_SIZE, SECTOR_SIZE, 0xaa);
+
+    /* nothing left to write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _writes);
+}
+
+static void test_mtd_cache_write_other_sector(void)
+{
+    memset(_buffer, 0x55, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 0, 8));
+    /* not adjacent */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 16, 8));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    /* other sector */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE, 8));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    TEST_ASSERT_EQUAL_INT(0, _cache.stats.merged);
+    /* written back before powering down, even if the parent can't */
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, mtd_power(_dev, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(3, _writes);
+
+    _test_mem(_dummy_memory, 8, 0x55);
+    _test_mem(_dummy_memory + 8, 8, 0xff);
+    _test_mem(_dummy_memory + 16, 8, 0x55);
+    _test_mem(_dummy_memory + SECTOR_SIZE, 8, 0x55);
+}
+
+static void test_mtd_cache_write_coherent(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0xff, _buffer[0]);
+
+    _buffer[0] = 0x12;
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, _buffer, 0, 4, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 4, 1));
+    TEST_ASSERT_EQUAL_INT(0x12, _buffer[0]);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+}
+
+static void test_mtd_cache_erase(void)
+{
+    memset(_buffer, 0x00, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0x00, _buffer[0]);
+
+    /* pending writes and cached pages of the erased sector are dropped */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 0, 1));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase_sector(_dev, SECTOR_COUNT, 1));
+}
+
+static void test_mtd_cache_write_page(void)
+{
+    /* read-modify-write through the cache */
+    memset(_buffer, 0x00, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+
+    memset(_buffer, 0xbb, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 0, 16, 16));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+
+    _test_mem(_dummy_memory, 16, 0x00);
+    _test_mem(_dummy_memory + 16, 16, 0xbb);
+    _test_mem(_dummy_memory + 32, PAGE_SIZE - 32, 0x00);
+    _test_mem(_dummy_memory + PAGE_SIZE, SECTOR_SIZE - PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_write_page(_dev, _buffer,
+                                         SECTOR_COUNT * PAGE_PER_SECTOR, 0, 1));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_read_hit),
+        new_TestFixture(test_mtd_cache_lru),
+        new_TestFixture(test_mtd_cache_read_large),
+        new_TestFixture(test_mtd_cache_write_combine),
+        new_TestFixture(test_mtd_cache_write_other_sector),
+        new_TestFixture(test_mtd_cache_write_coherent),
+        new_TestFixture(test_mtd_cache_erase),
+        new_TestFixture(test_mtd_cache_write_page),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+#if defined(MTD_0) && defined(BOARD_NATIVE)
+/* cache on top of the file backed flash emulation of native */
+static mtd_cache_entry_t _native_entries[4];
+static uint8_t _native_pages[4 * MTD_PAGE_SIZE];
+static uint8_t _native_wb[MTD_SECTOR_SIZE];
+static uint8_t _native_buf[MTD_PAGE_SIZE];
+
+static mtd_cache_t _native_cache = MTD_CACHE_INIT(NULL, _native_entries,
+                                                  _native_pages, _native_wb);
+
+static void test_mtd_cache_native(void)
+{
+    mtd_dev_t *dev = &_native_cache.mtd;
+
+    _native_cache.parent = MTD_0;
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 0, 1));
+
+    memset(_native_buf, 0x3c, sizeof(_native_buf));
+    for (uint32_t offset = 0; offset < MTD_PAGE_SIZE; offset += 32) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _native_buf, 1,
+                                                    offset, 32));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_native_cache));
+    TEST_ASSERT_EQUAL_INT(1, _native_cache.stats.flushes);
+
+    memset(_native_buf, 0, sizeof(_native_buf));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(MTD_0, _native_buf, 1, 0,
+                                           MTD_PAGE_SIZE));
+    _test_mem(_native_buf, MTD_PAGE_SIZE, 0x3c);
+
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _native_buf, 1, i, 1));
+        TEST_ASSERT_EQUAL_INT(0x3c, _native_buf[0]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, _native_cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(3, _native_cache.stats.hits);
+}
+
+Test *tests_mtd_cache_native_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_native),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_native_tests, NULL, NULL, fixtures);
+
+    return (Test *)&mtd_cache_native_tests;
+}
+#endif
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+#if defined(MTD_0) && defined(BOARD_NATIVE)
+    TESTS_RUN(tests_mtd_cache_native_tests());
+#endif
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Checks that boosting a ready mutex owner keeps the runqueues
+ *              intact and measures the worst-case wakeup latency of a high
+ *              priority thread waiting for a mutex held by a low priority
+ *              thread
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (50U)
+#endif
+
+/* time the low priority thread holds the outer mutex in each round */
+#ifndef HOLD_US
+#define HOLD_US             (2000U)
+#endif
+
+/* time the mid priority thread keeps the CPU busy when woken up */
+#ifndef HOG_US
+#define HOG_US              (20 * HOLD_US)
+#endif
+
+#define PRIO_LOW            (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID            (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH           (THREAD_PRIORITY_MAIN - 3)
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+static char _stack_peer[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _outer = MUTEX_INIT;
+static mutex_t _inner = MUTEX_INIT;
+static mutex_t _finished = MUTEX_INIT_LOCKED;
+static volatile bool _done;
+
+static kernel_pid_t _pid_low;
+static kernel_pid_t _pid_mid;
+
+static mutex_t _rq_lock = MUTEX_INIT;
+static volatile bool _rq_boosted;
+static volatile unsigned _rq_finished;
+
+static void *_rq_owner(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_rq_lock);
+    /* queue up behind the two peers of the same priority, so that we are
+     * not at the head of the runqueue when getting boosted */
+    thread_yield();
+    mutex_unlock(&_rq_lock);
+    _rq_finished++;
+
+    return NULL;
+}
+
+static void *_rq_peer(void *arg)
+{
+    (void)arg;
+
+    /* stay ready until the owner got boosted */
+    while (!_rq_boosted) {}
+    _rq_finished++;
+
+    return NULL;
+}
+
+static void *_rq_ctrl(void *arg)
+{
+    (void)arg;
+    bool failed = false;
+
+    /* runqueue of PRIO_LOW: owner, peer, peer */
+    kernel_pid_t owner = thread_create(_stack_low, sizeof(_stack_low),
+                                       PRIO_LOW, THREAD_CREATE_STACKTEST,
+                                       _rq_owner, NULL, "rq_owner");
+    thread_create(_stack_mid, sizeof(_stack_mid), PRIO_LOW,
+                  THREAD_CREATE_STACKTEST, _rq_peer, NULL, "rq_peer1");
+    thread_create(_stack_peer, sizeof(_stack_peer), PRIO_LOW,
+                  THREAD_CREATE_STACKTEST, _rq_peer, NULL, "rq_peer2");
+
+    /* let the owner lock the mutex and yield: peer, peer, owner */
+    ztimer_sleep(ZTIMER_USEC, HOLD_US);
+
+    /* boosts the owner while it is ready, but not at the head */
+    mutex_lock(&_rq_lock);
+    if (thread_get(owner)->priority != PRIO_LOW) {
+        failed = true;
+    }
+    mutex_unlock(&_rq_lock);
+    _rq_boosted = true;
+
+    /* all three threads must get the CPU again */
+    for (unsigned i = 0; (i < 10) && (_rq_finished < 3); i++) {
+        ztimer_sleep(ZTIMER_USEC, HOLD_US);
+    }
+    if (_rq_finished != 3) {
+        failed = true;
+    }
+
+    printf("boosting a ready owner behind its peers: %s\n",
+           failed ? "FAILURE" : "SUCCESS");
+
+    mutex_unlock(&_finished);
+    return NULL;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    /* keep holding the outer mutex, with a nested inner one, most of the time */
+    while (!_done) {
+        mutex_lock(&_outer);
+        mutex_lock(&_inner);
+        ztimer_spin(ZTIMER_USEC, HOLD_US / 2);
+        mutex_unlock(&_inner);
+        ztimer_spin(ZTIMER_USEC, HOLD_US / 2);
+        mutex_unlock(&_outer);
+    }
+
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        /* does not touch any mutex, but starves the low priority thread */
+        ztimer_spin(ZTIMER_USEC, HOG_US);
+    }
+
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+    uint32_t worst = 0;
+    unsigned failures = 0;
+
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        /* vary the point in the low priority thread's cycle we wake up at */
+        ztimer_sleep(ZTIMER_USEC, 3 * HOLD_US + (i * HOLD_US) / ITERATIONS);
+
+        /* make the mid priority thread ready, it runs as soon as we block */
+        thread_wakeup(_pid_mid);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        mutex_lock(&_outer);
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+
+        if (latency > worst) {
+            worst = latency;
+        }
+        if (thread_get(_pid_low)->priority != PRIO_LOW) {
+            /* the inherited priority must have been dropped on unlock */
+            failures++;
+        }
+        mutex_unlock(&_outer);
+    }
+
+    _done = true;
+    printf("worst-case wakeup latency: %" PRIu32 " us (hold: %u us, "
+           "hog: %u us)\n", worst, HOLD_US, HOG_US);
+
+    if (failures || (worst >= HOG_US)) {
+        puts("FAILURE");
+    }
+    else {
+        puts("SUCCESS");
+    }
+
+    mutex_unlock(&_finished);
+    return NULL;
+}
+
+int main(void)
+{
+    puts("mutex priority inheritance test");
+
+    thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH,
+                  THREAD_CREATE_STACKTEST, _rq_ctrl, NULL, "rq_ctrl");
+    /* all threads of the runqueue check have exited, reuse their stacks */
+    mutex_lock(&_finished);
+
+    _pid_low = thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                             THREAD_CREATE_STACKTEST, _low, NULL, "low");
+    _pid_mid = thread_create(_stack_mid, sizeof(_stack_mid), PRIO_MID,
+                             THREAD_CREATE_STACKTEST, _mid, NULL, "mid");
+    thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH,
+                  THREAD_CREATE_STACKTEST, _high, NULL, "high");
+
+    mutex_lock(&_finished);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/sched_edf
+ *
+ * Runs a set of periodic tasks with a total utilization of 70% in the EDF
+ * band while a lower priority thread tries to hog the CPU and measures how
+ * many jobs miss their deadline.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "sched_edf.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (3000000U)
+#endif
+
+/**
+ * @brief   Miss rate in per mille the test tolerates, e.g. due to the host
+ *          descheduling the native process
+ */
+#ifndef MAX_MISS_PERMILLE
+#define MAX_MISS_PERMILLE   (50U)
+#endif
+
+#define CALIBRATION_US      (20000U)
+
+typedef struct {
+    uint32_t period;
+    uint32_t deadline;
+    uint32_t wcet;
+    sched_edf_t edf;
+} task_t;
+
+static task_t _tasks[] = {
+    { .period = 50000, .deadline = 50000, .wcet = 15000 },
+    { .period = 70000, .deadline = 70000, .wcet = 21000 },
+    { .period = 100000, .deadline = 80000, .wcet = 10000 },
+};
+
+static char _stacks[ARRAY_SIZE(_tasks) + 1][THREAD_STACKSIZE_DEFAULT];
+static uint32_t _loops_per_ms;
+static uint32_t _start;
+
+static void _spin(uint32_t loops)
+{
+    for (volatile uint32_t i = 0; i < loops; i++) {}
+}
+
+static void _calibrate(void)
+{
+    uint32_t loops = 1000;
+    uint32_t time;
+
+    do {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        loops *= 2;
+        _spin(loops);
+        time = ztimer_now(ZTIMER_USEC) - start;
+    } while (time < CALIBRATION_US);
+    _loops_per_ms = ((uint64_t)loops * 1000) / time;
+}
+
+static void *_task(void *arg)
+{
+    task_t *task = arg;
+    uint32_t loops = ((uint64_t)_loops_per_ms * task->wcet) / 1000;
+
+    if (sched_edf_register(&task->edf, task->period, task->deadline) != 0) {
+        puts("registration failed");
+        return NULL;
+    }
+    while ((ztimer_now(ZTIMER_USEC) - _start) < TEST_DURATION_US) {
+        _spin(loops);
+        sched_edf_wait(&task->edf);
+    }
+    sched_edf_unregister(&task->edf);
+    return NULL;
+}
+
+static void *_hog(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        /* keep the CPU busy whenever no job is pending */
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    unsigned jobs = 0, misses = 0;
+    bool success = true;
+
+    _calibrate();
+    printf("%" PRIu32 " loops per ms\n", _loops_per_ms);
+
+    puts("starting tasks");
+    _start = ztimer_now(ZTIMER_USEC);
+    thread_create(_stacks[ARRAY_SIZE(_tasks)], sizeof(_stacks[0]),
+                  THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                  _hog, NULL, "hog");
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        thread_create(_stacks[i], sizeof(_stacks[0]), SCHED_EDF_PRIO,
+                      THREAD_CREATE_STACKTEST, _task, &_tasks[i], "edf");
+    }
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US + 200000U);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        sched_edf_t *edf = &_tasks[i].edf;
+        /* a task completes a job at least every other period */
+        unsigned min_jobs = TEST_DURATION_US / _tasks[i].period / 2;
+
+        printf("{ \"task\" : %u, \"jobs\" : %u, \"misses\" : %u }\n",
+               i, edf->jobs, edf->misses);
+        if ((edf->jobs < min_jobs) ||
+            (sched_pidlist[edf->thread->pid].deadline_misses != edf->misses)) {
+            success = false;
+        }
+        jobs += edf->jobs;
+        misses += edf->misses;
+    }
+    printf("miss rate: %u per mille\n", jobs ? (misses * 1000) / jobs : 0);
+    if ((jobs == 0) || ((misses * 1000) > (jobs * MAX_MISS_PERMILLE))) {
+        success = false;
+    }
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
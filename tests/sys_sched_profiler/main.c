@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test sys/sched_profiler
+ *
+ * Wakes up a thread from a timer interrupt a number of times and checks that
+ * the profiler recorded a wakeup latency for each of them.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "sched_profiler.h"
+#include "shell.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define NUMOF_WAKEUPS       (100U)
+#define WAKEUP_INTERVAL_US  (1000U)
+#define FLAG_WAKEUP         (0x1)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_thread;
+static unsigned _wakeups;
+
+static void _timer_cb(void *arg)
+{
+    thread_flags_set(arg, FLAG_WAKEUP);
+}
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        thread_flags_wait_any(FLAG_WAKEUP);
+        _wakeups++;
+    }
+    return NULL;
+}
+
+static unsigned _hist_sum(const sched_profiler_hist_t *hist)
+{
+    unsigned sum = 0;
+
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_NUMOF; i++) {
+        sum += hist->buckets[i];
+    }
+    return sum;
+}
+
+static bool _check(void)
+{
+    const sched_profiler_t *prof = &sched_profiler[_thread->pid];
+
+    /* the timer is the only source of wakeups of the waiter, apart from its
+     * creation */
+    if (_wakeups != NUMOF_WAKEUPS) {
+        printf("waiter woke up %u times\n", _wakeups);
+        return false;
+    }
+    if (_hist_sum(&prof->irq_latency) != NUMOF_WAKEUPS) {
+        printf("%u IRQ wakeups recorded\n", _hist_sum(&prof->irq_latency));
+        return false;
+    }
+    if (_hist_sum(&prof->latency) < (NUMOF_WAKEUPS + 1)) {
+        printf("%u wakeups recorded\n", _hist_sum(&prof->latency));
+        return false;
+    }
+    if (prof->switches < (NUMOF_WAKEUPS + 1)) {
+        printf("%" PRIu32 " switches recorded\n", prof->switches);
+        return false;
+    }
+#if IS_USED(MODULE_SCHED_PROFILER_CBOR)
+    static uint8_t cbor[512];
+    ssize_t len = sched_profiler_to_cbor(NULL, 0);
+
+    if ((len <= 0) || (len > (ssize_t)sizeof(cbor)) ||
+        (sched_profiler_to_cbor(cbor, sizeof(cbor)) != len)) {
+        printf("CBOR export failed: %d\n", (int)len);
+        return false;
+    }
+    printf("CBOR profile: %u bytes\n", (unsigned)len);
+#endif
+    return true;
+}
+
+int main(void)
+{
+    ztimer_t timer = { .callback = _timer_cb };
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    _thread = thread_get(thread_create(_stack, sizeof(_stack),
+                                       THREAD_PRIORITY_MAIN - 1,
+                                       THREAD_CREATE_STACKTEST, _waiter, NULL,
+                                       "waiter"));
+    timer.arg = _thread;
+    for (unsigned i = 0; i < NUMOF_WAKEUPS; i++) {
+        ztimer_set(ZTIMER_USEC, &timer, WAKEUP_INTERVAL_US);
+        ztimer_sleep(ZTIMER_USEC, 2 * WAKEUP_INTERVAL_US);
+    }
+    sched_profiler_print();
+    puts(_check() ? "[SUCCESS]" : "[FAILED]");
+
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
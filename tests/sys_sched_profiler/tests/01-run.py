@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("[SUCCESS]")
+    child.sendline("schedprof")
+    child.expect(r"\d+ \| waiter\s+\| +\d+ \| +\d+ \| \d+")
+    child.expect(r"irq latency \[us\]:( \d+:\d+)+")
+    child.sendline("schedprof reset")
+    child.sendline("schedprof")
+    child.expect_exact("| switches | preempted |")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author      agent <agent@local>
+ */
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "event.h"
+#include "mutex.h"
+#include "thread.h"
+
+#include "tests-event_loop_batch.h"
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+static event_queue_t _other = EVENT_QUEUE_INIT_DETACHED;
+static mutex_t _synced = MUTEX_INIT_LOCKED;
+
+static unsigned _count_first;
+static unsigned _count_second;
+static unsigned _count_forbidden;
+
+static void _sync_handler(event_t *event)
+{
+    (void)event;
+    mutex_unlock(&_synced);
+}
+
+static void _second_handler(event_t *event)
+{
+    (void)event;
+    _count_second++;
+}
+
+static void _forbidden_handler(event_t *event)
+{
+    (void)event;
+    _count_forbidden++;
+}
+
+static event_t _sync = { .handler = _sync_handler };
+static event_t _second = { .handler = _second_handler };
+
+static void *_loop(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+/* The event loop runs at a lower priority, so that all events posted before
+ * end up in the same batch. Returns once all these events were handled. */
+static void _sync_loop(void)
+{
+    event_post(&_queue, &_sync);
+    mutex_lock(&_synced);
+}
+
+static void _cancel_handler(event_t *event)
+{
+    (void)event;
+    _count_first++;
+    event_cancel(&_queue, &_second);
+}
+
+static void _cancel_repost_handler(event_t *event)
+{
+    _cancel_handler(event);
+    event_post(&_queue, &_second);
+}
+
+static void _cancel_reuse_handler(event_t *event)
+{
+    _cancel_handler(event);
+    /* reuse the memory of the cancelled event for another queue */
+    memset(&_second, 0xa5, sizeof(_second));
+    event_queue_init_detached(&_other);
+    _second.list_node.next = NULL;
+    _second.handler = _forbidden_handler;
+    event_post(&_other, &_second);
+}
+
+static void set_up(void)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                             THREAD_CREATE_STACKTEST, _loop, NULL, "batch");
+    }
+    _count_first = 0;
+    _count_second = 0;
+    _count_forbidden = 0;
+    memset(&_second, 0, sizeof(_second));
+    _second.handler = _second_handler;
+}
+
+static void test_event_loop_batch__handled(void)
+{
+    event_t first = { .handler = _second_handler };
+
+    event_post(&_queue, &first);
+    event_post(&_queue, &_second);
+    /* already queued */
+    event_post(&_queue, &_second);
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(2, _count_second);
+}
+
+static void test_event_loop_batch__cancel(void)
+{
+    event_t first = { .handler = _cancel_handler };
+
+    event_post(&_queue, &first);
+    event_post(&_queue, &_second);
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(1, _count_first);
+    TEST_ASSERT_EQUAL_INT(0, _count_second);
+}
+
+static void test_event_loop_batch__cancel_repost(void)
+{
+    event_t first = { .handler = _cancel_repost_handler };
+
+    event_post(&_queue, &first);
+    event_post(&_queue, &_second);
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(1, _count_first);
+    /* the re-posted event is only handled after the batch */
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(1, _count_second);
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(1, _count_second);
+}
+
+static void test_event_loop_batch__cancel_reuse(void)
+{
+    event_t first = { .handler = _cancel_reuse_handler };
+
+    event_post(&_queue, &first);
+    event_post(&_queue, &_second);
+    _sync_loop();
+    TEST_ASSERT_EQUAL_INT(1, _count_first);
+    TEST_ASSERT_EQUAL_INT(0, _count_second);
+    TEST_ASSERT_EQUAL_INT(0, _count_forbidden);
+    /* the event loop left the reused memory alone */
+    TEST_ASSERT(event_get(&_other) == &_second);
+    TEST_ASSERT_NULL(event_get(&_other));
+}
+
+static Test *tests_event_loop_batch_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_event_loop_batch__handled),
+        new_TestFixture(test_event_loop_batch__cancel),
+        new_TestFixture(test_event_loop_batch__cancel_repost),
+        new_TestFixture(test_event_loop_batch__cancel_reuse),
+    };
+
+    EMB_UNIT_TESTCALLER(event_loop_batch_tests, set_up, NULL, fixtures);
+
+    return (Test *)&event_loop_batch_tests;
+}
+
+void tests_event_loop_batch(void)
+{
+    TESTS_RUN(tests_event_loop_batch_tests());
+}
+/** @} */
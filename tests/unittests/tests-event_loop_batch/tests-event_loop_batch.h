@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the batching event loop
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef TESTS_EVENT_LOOP_BATCH_H
+#define TESTS_EVENT_LOOP_BATCH_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Entry point of the test suite
+ */
+void tests_event_loop_batch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_EVENT_LOOP_BATCH_H */
+/** @} */
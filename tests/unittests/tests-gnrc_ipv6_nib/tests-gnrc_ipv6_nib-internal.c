@@ -532,6 +532,35 @@ static void test_nib_nc_add__cache_out_crash(void)
     }
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
+ * addresses and a garbage-collectible AR state, looks up the first, and then
+ * adds another.
+ * Expected result: the second entry, which was used least recently, should be
+ * replaced
+ */
+static void test_nib_nc_add__cache_out_lru(void)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t first = addr, second = addr;
+
+    second.u64[1].u64++;
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL(_nib_nc_add(&addr, IFACE,
+                                         GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+        addr.u64[1].u64++;
+    }
+    TEST_ASSERT_NOT_NULL(_nib_onl_get(&first, IFACE));
+    TEST_ASSERT_NOT_NULL(_nib_nc_add(&addr, IFACE,
+                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    TEST_ASSERT_NOT_NULL(_nib_onl_get(&first, IFACE));
+    TEST_ASSERT_NULL(_nib_onl_get(&second, IFACE));
+    TEST_ASSERT_NOT_NULL(_nib_onl_get(&addr, IFACE));
+}
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASH */
+
 /*
  * Creates a neighbor cache entry and sets it reachable
  * Expected result: node->info flags set to NUD_STATE_REACHABLE and NIB's event
@@ -2027,6 +2056,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_nc_add__success),
         new_TestFixture(test_nib_nc_add__success_full_but_garbage_collectible),
         new_TestFixture(test_nib_nc_add__cache_out_crash),
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASH)
+        new_TestFixture(test_nib_nc_add__cache_out_lru),
+#endif
         new_TestFixture(test_nib_nc_remove__uncleared),
         new_TestFixture(test_nib_nc_remove__cleared),
         new_TestFixture(test_nib_nc_set_reachable__success),
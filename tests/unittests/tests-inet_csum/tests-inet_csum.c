@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,74 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straightforward implementation to compare the optimized one against */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__alignment(void)
+{
+    /* covers all alignments, the unrolled loop and the remainders */
+    uint8_t data[80];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = 0xff - (i * 7);
+    }
+    for (unsigned start = 0; start < 4; start++) {
+        for (unsigned len = 0; len < sizeof(data) - start; len++) {
+            TEST_ASSERT_EQUAL_INT(_csum_bytewise(0x1234, &data[start], len),
+                                  inet_csum(0x1234, &data[start], len));
+        }
+    }
+}
+
+static void test_inet_csum__update(void)
+{
+    uint8_t data[] = {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7
+    };
+    uint16_t csum = ~inet_csum(0, data, sizeof(data));
+
+    /* change 0xf4f5 to 0x1234 */
+    csum = inet_csum_update(csum, 0xf4f5, 0x1234);
+    data[4] = 0x12;
+    data[5] = 0x34;
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
+static void test_inet_csum__update_rfc1624(void)
+{
+    /* RFC 1624, section 4: yields 0x0000 not 0xffff like equation 2 would */
+    TEST_ASSERT_EQUAL_INT(0x0000, inet_csum_update(0xdd2f, 0x5555, 0x3285));
+}
+
+static void test_inet_csum__replace(void)
+{
+    uint8_t data[] = {
+        0x60, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x11, 0x40,
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x1a, 0x2b, 0xff, 0xfe, 0x3c, 0x4d, 0x5e,
+    };
+    uint8_t addr[] = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    };
+    uint16_t csum = ~inet_csum(0, data, sizeof(data));
+
+    csum = inet_csum_replace(csum, &data[8], addr, sizeof(addr));
+    memcpy(&data[8], addr, sizeof(addr));
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +245,10 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignment),
+        new_TestFixture(test_inet_csum__update),
+        new_TestFixture(test_inet_csum__update_rfc1624),
+        new_TestFixture(test_inet_csum__replace),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -19,6 +19,7 @@
 
 #include "embUnit.h"
 
+#include "kernel_defines.h"
 #include "net/nanocoap.h"
 
 #include "unittests-constants.h"
@@ -1060,6 +1061,46 @@ static void test_nanocoap__token_length_over_limit(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
+/*
+ * Verifies that coap_find_resource() skips exactly the resources a linear
+ * search with coap_match_path() would skip, also with subtree resources.
+ */
+static void test_nanocoap__find_resource(void)
+{
+    static const coap_resource_t resources[] = {
+        { "/a", COAP_GET, NULL, NULL },
+        { "/sensors", COAP_GET, NULL, NULL },
+        { "/sensors/", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+        { "/sensors/", COAP_PUT | COAP_MATCH_SUBTREE, NULL, NULL },
+        { "/sensors/hum", COAP_GET, NULL, NULL },
+        { "/sensors/temp", COAP_GET, NULL, NULL },
+        { "/sensors/temp/max", COAP_GET, NULL, NULL },
+        { "/x", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+        { "/xy", COAP_GET, NULL, NULL },
+    };
+    static const char *uris[] = {
+        "", "/", "/a", "/b", "/sensors", "/sensors/", "/sensors/hum",
+        "/sensors/light", "/sensors/temp", "/sensors/temp/min", "/sensorsx",
+        "/x", "/xy", "/xyz", "/z",
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(uris); i++) {
+        unsigned first = ARRAY_SIZE(resources);
+
+        for (unsigned j = 0; j < ARRAY_SIZE(resources); j++) {
+            if (coap_match_path(&resources[j], (uint8_t *)uris[i]) <= 0) {
+                first = j;
+                break;
+            }
+        }
+        TEST_ASSERT_EQUAL_INT(first,
+                              coap_find_resource(resources,
+                                                 ARRAY_SIZE(resources),
+                                                 uris[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, coap_find_resource(resources, 0, "/a"));
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1096,6 +1137,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__add_path_unterminated_string),
         new_TestFixture(test_nanocoap__add_get_proxy_uri),
         new_TestFixture(test_nanocoap__token_length_over_limit),
+        new_TestFixture(test_nanocoap__find_resource),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -97,6 +97,24 @@ void test_netreg_lookup__wrong_type_numof(void)
     TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_NUMOF, TEST_UINT16));
 }
 
+void test_netreg_lookup__other_type(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entries[1]));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT(res == &entries[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16)));
+    TEST_ASSERT(res == &entries[1]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &entries[1]);
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16) == &entries[0]);
+}
+
 void test_netreg_num__empty(void)
 {
     TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
@@ -149,6 +167,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_unregister__success3),
         new_TestFixture(test_netreg_lookup__wrong_type_undef),
         new_TestFixture(test_netreg_lookup__wrong_type_numof),
+        new_TestFixture(test_netreg_lookup__other_type),
         new_TestFixture(test_netreg_num__empty),
         new_TestFixture(test_netreg_num__wrong_type_undef),
         new_TestFixture(test_netreg_num__wrong_type_numof),
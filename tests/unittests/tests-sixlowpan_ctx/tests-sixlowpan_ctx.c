@@ -195,6 +195,20 @@ static void test_sixlowpan_ctx_remove(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_generation(void)
+{
+    unsigned generation = gnrc_sixlowpan_ctx_generation();
+
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT(generation != gnrc_sixlowpan_ctx_generation());
+    generation = gnrc_sixlowpan_ctx_generation();
+    /* lookups do not change the generation */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID));
+    TEST_ASSERT_EQUAL_INT(generation, gnrc_sixlowpan_ctx_generation());
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT(generation != gnrc_sixlowpan_ctx_generation());
+}
+
 Test *tests_sixlowpan_ctx_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -211,6 +225,7 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
         new_TestFixture(test_sixlowpan_ctx_remove),
+        new_TestFixture(test_sixlowpan_ctx_generation),
     };
 
     EMB_UNIT_TESTCALLER(sixlowpan_ctx_tests, NULL, tear_down, fixtures);
@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * @author      agent <agent@local>
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "unittests-constants.h"
+#include "spscrb.h"
+#include "tests-spscrb.h"
+
+#define TEST_INPUT          (0xdb)
+#define TEST_DROP_NUM       (4U)
+#define TEST_OFFSET         (5U)
+#define BUFFER_SIZE         (16)    /* intentionally not unsigned to easier
+                                     * check for implicit casting problems */
+#define IO_BUFFER_CANARY    (0xb8)
+
+static uint8_t _rb_buffer[BUFFER_SIZE];
+static uint8_t _io_buffer[BUFFER_SIZE * 2];
+static spscrb_t _rb = SPSCRB_INIT(_rb_buffer);
+
+static void tear_down(void)
+{
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    memset(_rb_buffer, 0, sizeof(_rb_buffer));
+    spscrb_init(&_rb, _rb_buffer, BUFFER_SIZE);
+}
+
+/* moves the indices so that the next BUFFER_SIZE bytes wrap around */
+static void _offset(void)
+{
+    for (unsigned i = 0; i < TEST_OFFSET; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, spscrb_consume(&_rb, TEST_OFFSET));
+}
+
+static void test_clear(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+        TEST_ASSERT_EQUAL_INT(i + 1, spscrb_avail(&_rb));
+    }
+
+    spscrb_clear(&_rb);
+
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_free(&_rb));
+}
+
+static void test_discard(void)
+{
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    }
+
+    spscrb_discard(&_rb);
+
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+    /* space is reclaimed by the consumer */
+    TEST_ASSERT_EQUAL_INT(0, spscrb_free(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_free(&_rb));
+
+    /* data added after the discard is kept */
+    spscrb_discard(&_rb);
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+}
+
+static void test_empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_empty(&_rb));
+}
+
+static void test_full(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, spscrb_full(&_rb));
+
+    for (int i = 0; i < (BUFFER_SIZE - 1); i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+        TEST_ASSERT_EQUAL_INT(0, spscrb_full(&_rb));
+    }
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+}
+
+static void test_free(void)
+{
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_free(&_rb));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+        TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - (i + 1), spscrb_free(&_rb));
+    }
+}
+
+static void test_get_one(void)
+{
+    int res;
+
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, 0xff));
+    res = spscrb_get_one(&_rb);
+    TEST_ASSERT_EQUAL_INT(0xff, res);
+    /* 0xff is -1 in signed int8_t */
+    TEST_ASSERT(-1 != res);
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+}
+
+static void test_peek_one(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_peek_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_peek_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_peek_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_peek_one(&_rb));
+}
+
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    _offset();
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add(&_rb, _io_buffer, 0));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_add(&_rb, _io_buffer,
+                                                  sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_peek(&_rb, _io_buffer,
+                                                   sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_avail(&_rb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_get(&_rb, _io_buffer,
+                                                  sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    for (int i = BUFFER_SIZE; i < (int)sizeof(_io_buffer); i++) {
+        TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static void test_consume(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, spscrb_consume(&_rb, sizeof(_io_buffer)));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, spscrb_consume(&_rb, TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM, spscrb_get_one(&_rb));
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *region;
+    size_t len;
+
+    _offset();
+    region = spscrb_reserve(&_rb, &len);
+    /* only up to the end of the buffer is contiguous */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET, len);
+    TEST_ASSERT(region == &_rb_buffer[TEST_OFFSET]);
+    memset(region, TEST_INPUT, len);
+    spscrb_commit(&_rb, len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET, spscrb_avail(&_rb));
+
+    region = spscrb_reserve(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, len);
+    TEST_ASSERT(region == _rb_buffer);
+    spscrb_commit(&_rb, len);
+
+    region = spscrb_reserve(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(0, len);
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+}
+
+static void test_peek_contig(void)
+{
+    const uint8_t *region;
+    size_t len;
+
+    region = spscrb_peek_contig(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(0, len);
+
+    _offset();
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT + i));
+    }
+    region = spscrb_peek_contig(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET, len);
+    TEST_ASSERT(region == &_rb_buffer[TEST_OFFSET]);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, region[0]);
+    TEST_ASSERT_EQUAL_INT(len, spscrb_consume(&_rb, len));
+
+    region = spscrb_peek_contig(&_rb, &len);
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, len);
+    TEST_ASSERT(region == _rb_buffer);
+    TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE - TEST_OFFSET),
+                          region[0]);
+    TEST_ASSERT_EQUAL_INT(len, spscrb_consume(&_rb, len));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static Test *tests_spscrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_clear),
+        new_TestFixture(test_discard),
+        new_TestFixture(test_empty),
+        new_TestFixture(test_full),
+        new_TestFixture(test_free),
+        new_TestFixture(test_get_one),
+        new_TestFixture(test_peek_one),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_consume),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_contig),
+    };
+
+    EMB_UNIT_TESTCALLER(spscrb_tests, NULL, tear_down, fixtures);
+
+    return (Test *)&spscrb_tests;
+}
+
+void tests_spscrb(void)
+{
+    TESTS_RUN(tests_spscrb_tests());
+}
+/** @} */
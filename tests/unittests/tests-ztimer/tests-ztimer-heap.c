@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer pairing heap timer queue
+ *
+ * @author      agent <agent@local>
+ */
+
+#include "ztimer.h"
+#include "ztimer/heap.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define HEAP_NUMOF      (64U)
+
+static ztimer_t _timers[HEAP_NUMOF];
+static uint32_t _fired_at[HEAP_NUMOF];
+static unsigned _fired;
+static ztimer_mock_t _zmock;
+
+static void _cb_record(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    _fired_at[idx] = ztimer_now(&_zmock.super);
+    _fired++;
+}
+
+/* simple LCG, the tests need a reproducible but scrambled order */
+static uint32_t _rand(uint32_t *state)
+{
+    *state = *state * 1103515245UL + 12345UL;
+    return *state >> 8;
+}
+
+static void _setup(bool heap)
+{
+    ztimer_mock_init(&_zmock, 32);
+    if (heap) {
+        ztimer_heap_enable(&_zmock.super);
+    }
+    _fired = 0;
+    for (unsigned i = 0; i < HEAP_NUMOF; i++) {
+        _timers[i] = (ztimer_t){ .callback = _cb_record,
+                                 .arg = (void *)(uintptr_t)i };
+        _fired_at[i] = 0;
+    }
+}
+
+/**
+ * @brief   Timers set in scrambled order fire exactly at their targets
+ */
+static void test_ztimer_heap_order(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t targets[HEAP_NUMOF];
+    uint32_t seed = 1;
+
+    _setup(true);
+    for (unsigned i = 0; i < HEAP_NUMOF; i++) {
+        targets[i] = 1 + (_rand(&seed) % 10000);
+        ztimer_set(z, &_timers[i], targets[i]);
+    }
+
+    for (unsigned t = 0; t < 10001; t += 7) {
+        ztimer_mock_advance(&_zmock, 7);
+    }
+
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF, _fired);
+    for (unsigned i = 0; i < HEAP_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(targets[i], _fired_at[i]);
+        TEST_ASSERT(!ztimer_is_set(z, &_timers[i]));
+    }
+}
+
+/**
+ * @brief   Removing and re-setting arbitrary timers keeps the heap sane
+ */
+static void test_ztimer_heap_remove(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t seed = 42;
+
+    _setup(true);
+    for (unsigned i = 0; i < HEAP_NUMOF; i++) {
+        ztimer_set(z, &_timers[i], 100 + (_rand(&seed) % 1000));
+    }
+
+    /* remove every odd timer, re-set every fourth one to fire early */
+    for (unsigned i = 1; i < HEAP_NUMOF; i += 2) {
+        TEST_ASSERT(ztimer_remove(z, &_timers[i]));
+        TEST_ASSERT(!ztimer_is_set(z, &_timers[i]));
+        TEST_ASSERT(!ztimer_remove(z, &_timers[i]));
+    }
+    for (unsigned i = 0; i < HEAP_NUMOF; i += 4) {
+        TEST_ASSERT(ztimer_is_set(z, &_timers[i]));
+        ztimer_set(z, &_timers[i], 50);
+    }
+
+    ztimer_mock_advance(&_zmock, 50);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF / 4, _fired);
+
+    ztimer_mock_advance(&_zmock, 2000);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF / 2, _fired);
+    for (unsigned i = 1; i < HEAP_NUMOF; i += 2) {
+        TEST_ASSERT_EQUAL_INT(0, _fired_at[i]);
+    }
+}
+
+/**
+ * @brief   Jumping past many targets at once fires all of them
+ */
+static void test_ztimer_heap_expired(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    /* shares the slot of _timers[0] in _fired_at, which fires earlier */
+    ztimer_t late = { .callback = _cb_record, .arg = (void *)0 };
+
+    _setup(true);
+    for (unsigned i = 0; i < HEAP_NUMOF; i++) {
+        ztimer_set(z, &_timers[i], 1000 - i);
+    }
+
+    /* set() moves the base past all targets without the alarm firing */
+    ztimer_mock_jump(&_zmock, 2000);
+    ztimer_set(z, &late, 10);
+    TEST_ASSERT_EQUAL_INT(0, _fired);
+    ztimer_mock_fire(&_zmock);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF, _fired);
+    TEST_ASSERT(ztimer_is_set(z, &late));
+
+    ztimer_mock_advance(&_zmock, 10);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF + 1, _fired);
+    TEST_ASSERT_EQUAL_INT(2010, _fired_at[0]);
+
+    ztimer_set(z, &late, UINT32_MAX);
+    ztimer_mock_advance(&_zmock, UINT32_MAX - 1);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF + 1, _fired);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(HEAP_NUMOF + 2, _fired);
+}
+
+/**
+ * @brief   Enabling the heap migrates timers already set on the clock
+ */
+static void test_ztimer_heap_enable(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup(false);
+    for (unsigned i = 0; i < 8; i++) {
+        ztimer_set(z, &_timers[i], 100 * (8 - i));
+    }
+    ztimer_mock_advance(&_zmock, 150);
+    TEST_ASSERT_EQUAL_INT(1, _fired);
+
+    ztimer_heap_enable(z);
+    for (unsigned i = 0; i < 7; i++) {
+        TEST_ASSERT(ztimer_is_set(z, &_timers[i]));
+    }
+    TEST_ASSERT(ztimer_remove(z, &_timers[3]));
+    ztimer_mock_advance(&_zmock, 650);
+    TEST_ASSERT_EQUAL_INT(7, _fired);
+    TEST_ASSERT_EQUAL_INT(800, _fired_at[0]);
+    TEST_ASSERT_EQUAL_INT(0, _fired_at[3]);
+}
+
+Test *tests_ztimer_heap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_heap_order),
+        new_TestFixture(test_ztimer_heap_remove),
+        new_TestFixture(test_ztimer_heap_expired),
+        new_TestFixture(test_ztimer_heap_enable),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */
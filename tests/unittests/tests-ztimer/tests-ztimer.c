@@ -21,10 +21,12 @@
 
 Test *tests_ztimer_mock_tests(void);
 Test *tests_ztimer_convert_muldiv64_tests(void);
+Test *tests_ztimer_heap_tests(void);
 
 void tests_ztimer(void)
 {
     TESTS_RUN(tests_ztimer_mock_tests());
     TESTS_RUN(tests_ztimer_convert_muldiv64_tests());
+    TESTS_RUN(tests_ztimer_heap_tests());
 }
 /** @} */